@@ -202,6 +202,9 @@ namespace Oxygen
 
         if (!decoration()) return;
 
+        // cached pixmaps must match the device being painted on
+        const DevicePixelRatio::Scope devicePixelRatioScope( painter );
+
         painter->save();
 
         // translate from offset
@@ -232,7 +235,10 @@ namespace Oxygen
         QColor color = foregroundColor( palette );
 
         // decide decoration color
+        // during animations, hover glyph and glow are composited over the base ones at draw time opacity
         QColor glow;
+        QColor hoverColor;
+        QColor hoverGlow;
         if( isAnimated() || isHovered() || ( isToggleButton() && isChecked() ) )
         {
 
@@ -248,11 +254,14 @@ namespace Oxygen
             if( isAnimated() )
             {
                 if( isToggleButton() && isChecked() ) {
-                    color = KColorUtils::mix( toggleColor, toggledHoverColor, m_opacity );
-                    glow = KColorUtils::mix( toggleColor, toggledHoverGlow, m_opacity );
+                    color = toggleColor;
+                    hoverColor = toggledHoverColor;
+                    glow = toggleColor;
+                    hoverGlow = toggledHoverGlow;
                 } else {
-                    color = KColorUtils::mix( color, glow, m_opacity );
-                    glow = SettingsProvider::self()->helper()->alphaColor( glow, m_opacity );
+                    hoverColor = glow;
+                    hoverGlow = glow;
+                    glow = QColor();
                 }
 
             } else if ( ! isHovered() != !( isToggleButton() && isChecked() ) ) color = glow;               // If button is eigther hovered or checked, use glow color as text color
@@ -260,159 +269,71 @@ namespace Oxygen
 
         }
 
+        // device pixel ratio of the target, so that cached layers are never scaled
+        const qreal devicePixelRatio( painter->device()->devicePixelRatioF() );
+        const int size( m_iconSize.width() );
+        auto helper( SettingsProvider::self()->helper() );
+
         // draw button shape
         const bool sunken = isPressed() || ( isToggleButton() && isChecked() );
-        const QRectF iconRect( geometry().topLeft(), m_iconSize  );
-        painter->drawPixmap(iconRect.topLeft(), SettingsProvider::self()->helper()->windecoButton( base, glow, sunken, m_iconSize.width() ) );
-
-        // Icon
-        painter->setRenderHints(QPainter::Antialiasing);
-        painter->translate( geometry().topLeft() );
-
-        qreal width( 1.2 );
-
-        // contrast
-        painter->setBrush(Qt::NoBrush);
-        painter->translate(0, 1.5);
-        painter->setPen(QPen( SettingsProvider::self()->helper()->calcLightColor( base ), width, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-        drawIcon(painter);
-
-        // main
-        painter->translate(0,-1.5);
-        painter->setPen(QPen(color, width, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-        drawIcon(painter);
-
-        painter->restore();
-    }
-
-    //___________________________________________________
-    void Button::drawIcon( QPainter* painter )
-    {
-        painter->save();
-
-        //keep all co-ordinates between 0 and 21
-        const qreal width( m_iconSize.width() );
-        painter->scale( width/21, width/21 );
-
-        // make sure pen width is always larger than 1.1 in "real" coordinates
-        QPen pen( painter->pen() );
-        pen.setWidthF( qMax( 1.1*21/width, pen.widthF() ) );
-        painter->setPen( pen );
-
-        switch(type())
+        const QPointF topLeft( geometry().topLeft() );
+        if( hoverGlow.isValid() )
         {
 
-            case KDecoration2::DecorationButtonType::OnAllDesktops:
-            painter->drawPoint(QPointF(10.5,10.5));
-            break;
-
-            case KDecoration2::DecorationButtonType::ContextHelp:
-            painter->translate(1.5, 1.5);
-            painter->drawArc(7,5,4,4,135*16, -180*16);
-            painter->drawArc(9,8,4,4,135*16,45*16);
-            painter->drawPoint(9,12);
-            painter->translate(-1.5, -1.5);
-            break;
-
-            case KDecoration2::DecorationButtonType::ApplicationMenu:
-            painter->drawLine(QPointF(7.5, 7.5), QPointF(13.5, 7.5));
-            painter->drawLine(QPointF(7.5, 10.5), QPointF(13.5, 10.5));
-            painter->drawLine(QPointF(7.5, 13.5), QPointF(13.5, 13.5));
-            break;
-
-            case KDecoration2::DecorationButtonType::Minimize:
-            {
-                painter->drawPolyline( QPolygonF()
-                    << QPointF(7.5, 9.5)
-                    << QPointF(10.5, 12.5)
-                    << QPointF(13.5, 9.5) );
-                break;
-            }
+            painter->drawPixmap( topLeft, helper->windecoButtonShadow( base, size, devicePixelRatio ) );
+            if( glow.isValid() ) painter->drawPixmap( topLeft, helper->windecoButtonGlow( glow, size, devicePixelRatio ) );
 
-            case KDecoration2::DecorationButtonType::Maximize:
-            if(decoration()->client().data()->isMaximized())
-            {
+            painter->setOpacity( m_opacity );
+            painter->drawPixmap( topLeft, helper->windecoButtonGlow( hoverGlow, size, devicePixelRatio ) );
+            painter->setOpacity( 1 );
 
-                painter->drawPolygon( QPolygonF()
-                    << QPointF(7.5, 10.5)
-                    << QPointF(10.5, 7.5)
-                    << QPointF(13.5, 10.5)
-                    << QPointF(10.5, 13.5) );
+            painter->drawPixmap( topLeft, helper->windecoButtonSlab( base, sunken, size, devicePixelRatio ) );
 
-            } else {
+        } else painter->drawPixmap( topLeft, helper->windecoButton( base, glow, sunken, size, devicePixelRatio ) );
 
-                painter->drawPolyline( QPolygonF()
-                    << QPointF(7.5, 11.5)
-                    << QPointF(10.5, 8.5)
-                    << QPointF(13.5, 11.5) );
+        // icon
+        const DecoHelper::WindecoGlyph glyph( this->glyph() );
+        if( glyph != DecoHelper::GlyphNone )
+        {
 
-            }
-            break;
+            // contrast
+            painter->drawPixmap( topLeft, helper->windecoGlyph( glyph, helper->calcLightColor( base ), true, size, devicePixelRatio ) );
 
-            case KDecoration2::DecorationButtonType::Close:
-            painter->drawLine(QPointF( 7.5,7.5), QPointF(13.5,13.5));
-            painter->drawLine(QPointF(13.5,7.5), QPointF( 7.5,13.5));
-            break;
+            // main
+            painter->drawPixmap( topLeft, helper->windecoGlyph( glyph, color, false, size, devicePixelRatio ) );
 
-            case KDecoration2::DecorationButtonType::KeepAbove:
+            // hover
+            if( hoverColor.isValid() )
             {
-                painter->drawPolyline( QPolygonF()
-                    << QPointF( 7.5, 14)
-                    << QPointF(10.5, 11)
-                    << QPointF(13.5, 14) );
-
-                painter->drawPolyline( QPolygonF()
-                    << QPointF(7.5, 10)
-                    << QPointF(10.5, 7)
-                    << QPointF(13.5, 10) );
-                break;
-
+                painter->setOpacity( m_opacity );
+                painter->drawPixmap( topLeft, helper->windecoGlyph( glyph, hoverColor, false, size, devicePixelRatio ) );
             }
 
-            case KDecoration2::DecorationButtonType::KeepBelow:
-            {
-                painter->drawPolyline( QPolygonF()
-                    << QPointF( 7.5, 11)
-                    << QPointF(10.5, 14)
-                    << QPointF(13.5, 11) );
+        }
 
-                painter->drawPolyline( QPolygonF()
-                    << QPointF(7.5, 7)
-                    << QPointF(10.5, 10)
-                    << QPointF(13.5, 7) );
+        painter->restore();
+    }
 
-                break;
-            }
+    //___________________________________________________
+    DecoHelper::WindecoGlyph Button::glyph( void ) const
+    {
+        switch(type())
+        {
+            case KDecoration2::DecorationButtonType::OnAllDesktops: return DecoHelper::GlyphOnAllDesktops;
+            case KDecoration2::DecorationButtonType::ContextHelp: return DecoHelper::GlyphContextHelp;
+            case KDecoration2::DecorationButtonType::ApplicationMenu: return DecoHelper::GlyphApplicationMenu;
+            case KDecoration2::DecorationButtonType::Minimize: return DecoHelper::GlyphMinimize;
+            case KDecoration2::DecorationButtonType::Maximize:
+            return decoration()->client().data()->isMaximized() ? DecoHelper::GlyphRestore:DecoHelper::GlyphMaximize;
 
+            case KDecoration2::DecorationButtonType::Close: return DecoHelper::GlyphClose;
+            case KDecoration2::DecorationButtonType::KeepAbove: return DecoHelper::GlyphKeepAbove;
+            case KDecoration2::DecorationButtonType::KeepBelow: return DecoHelper::GlyphKeepBelow;
             case KDecoration2::DecorationButtonType::Shade:
-            if (!isChecked())
-            {
-
-                // shade button
-                painter->drawPolyline( QPolygonF()
-                        << QPointF(7.5, 7.5)
-                        << QPointF(10.5, 10.5)
-                        << QPointF(13.5, 7.5) );
-
-                painter->drawLine(QPointF( 7.5,13.0), QPointF(13.5,13.0));
-
-            } else {
+            return isChecked() ? DecoHelper::GlyphUnshade:DecoHelper::GlyphShade;
 
-                painter->drawPolyline( QPolygonF()
-                    << QPointF(7.5, 10.5)
-                    << QPointF(10.5, 7.5)
-                    << QPointF(13.5, 10.5) );
-
-                painter->drawLine(QPointF( 7.5,13.0), QPointF(13.5,13.0));
-
-            }
-            break;
-
-            default:
-            break;
+            default: return DecoHelper::GlyphNone;
         }
-        painter->restore();
-        return;
     }
 
     //__________________________________________________________________
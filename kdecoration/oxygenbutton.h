@@ -96,8 +96,8 @@ namespace Oxygen
 
         private:
 
-        //* draw icon
-        void drawIcon( QPainter* );
+        //* glyph matching button type and state
+        DecoHelper::WindecoGlyph glyph( void ) const;
 
         //*@name colors
         //@{
@@ -18,6 +18,32 @@
 namespace Oxygen
 {
 
+    namespace
+    {
+
+        //* windeco button layers
+        enum WindecoLayer
+        {
+            LayerShadow = 1,
+            LayerGlow,
+            LayerSlab
+        };
+
+        //* device pixel ratio, in 1/16th steps, as stored in cache keys
+        quint64 devicePixelRatioKey( qreal devicePixelRatio )
+        { return quint64( qRound( devicePixelRatio*16 ) ) & 0xff; }
+
+        //* transparent pixmap for given logical size and device pixel ratio
+        QPixmap windecoPixmap( int size, qreal devicePixelRatio )
+        {
+            QPixmap pixmap( QSize( size, size )*devicePixelRatio );
+            pixmap.setDevicePixelRatio( devicePixelRatio );
+            pixmap.fill( Qt::transparent );
+            return pixmap;
+        }
+
+    }
+
     //______________________________________________________________________________
     DecoHelper::DecoHelper():
         Helper(KSharedConfig::openConfig("oxygenrc"))
@@ -31,91 +57,315 @@ namespace Oxygen
 
         // local caches
         _windecoButtonCache.clear();
+        _windecoButtonLayerCache.clear();
+        _windecoGlyphCache.clear();
 
     }
 
     //______________________________________________________________________________
-    QPixmap DecoHelper::windecoButton(const QColor &color, const QColor& glow, bool sunken, int size)
+    QPixmap DecoHelper::windecoButton(const QColor &color, const QColor& glow, bool sunken, int size, qreal devicePixelRatio)
     {
 
         Oxygen::Cache<QPixmap>::Value cache( _windecoButtonCache.get( color ) );
 
-        const quint64 key( ( colorKey(glow) << 32 ) | (sunken << 23 ) | size );
+        const quint64 key( ( colorKey(glow) << 32 ) | ( devicePixelRatioKey( devicePixelRatio ) << 24 ) | (sunken << 23 ) | size );
 
         if( QPixmap *cachedPixmap = cache->object( key ) )
         { return *cachedPixmap; }
 
-        QPixmap pixmap( size, size );
-        pixmap.fill(Qt::transparent);
+        QPixmap pixmap( windecoPixmap( size, devicePixelRatio ) );
 
         QPainter p( &pixmap );
         p.setRenderHints(QPainter::Antialiasing);
         p.setPen(Qt::NoPen);
         p.setWindow( 0, 0, 21, 21 );
 
-        // button shadow
-        if( color.isValid() )
-        {
-            p.save();
-            p.translate( 0, -0.2 );
-            drawShadow( p, calcShadowColor( color ), 21 );
-            p.restore();
-        }
+        renderWindecoShadow( p, color );
+        renderWindecoGlow( p, glow );
+        renderWindecoSlab( p, color, sunken );
 
-        // button glow
-        if( glow.isValid() )
-        {
-            p.save();
-            p.translate( 0, -0.2 );
-            drawOuterGlow( p, glow, 21 );
-            p.restore();
-        }
+        p.end();
+        cache->insert( key, new QPixmap(pixmap) );
+
+        return pixmap;
+    }
+
+    //______________________________________________________________________________
+    QPixmap DecoHelper::windecoButtonShadow( const QColor& color, int size, qreal devicePixelRatio )
+    {
+
+        Oxygen::Cache<QPixmap>::Value cache( _windecoButtonLayerCache.get( color ) );
+
+        const quint64 key( ( quint64( LayerShadow ) << 32 ) | ( devicePixelRatioKey( devicePixelRatio ) << 24 ) | size );
+
+        if( QPixmap *cachedPixmap = cache->object( key ) )
+        { return *cachedPixmap; }
+
+        QPixmap pixmap( windecoPixmap( size, devicePixelRatio ) );
+
+        QPainter p( &pixmap );
+        p.setRenderHints(QPainter::Antialiasing);
+        p.setPen(Qt::NoPen);
+        p.setWindow( 0, 0, 21, 21 );
+        renderWindecoShadow( p, color );
+        p.end();
+
+        cache->insert( key, new QPixmap(pixmap) );
+        return pixmap;
 
-        // button slab
+    }
+
+    //______________________________________________________________________________
+    QPixmap DecoHelper::windecoButtonGlow( const QColor& glow, int size, qreal devicePixelRatio )
+    {
+
+        // glow is always rendered opaque
+        QColor color( glow );
+        color.setAlpha( 255 );
+
+        Oxygen::Cache<QPixmap>::Value cache( _windecoButtonLayerCache.get( color ) );
+
+        const quint64 key( ( quint64( LayerGlow ) << 32 ) | ( devicePixelRatioKey( devicePixelRatio ) << 24 ) | size );
+
+        if( QPixmap *cachedPixmap = cache->object( key ) )
+        { return *cachedPixmap; }
+
+        QPixmap pixmap( windecoPixmap( size, devicePixelRatio ) );
+
+        QPainter p( &pixmap );
+        p.setRenderHints(QPainter::Antialiasing);
+        p.setPen(Qt::NoPen);
+        p.setWindow( 0, 0, 21, 21 );
+        renderWindecoGlow( p, color );
+        p.end();
+
+        cache->insert( key, new QPixmap(pixmap) );
+        return pixmap;
+
+    }
+
+    //______________________________________________________________________________
+    QPixmap DecoHelper::windecoButtonSlab( const QColor& color, bool sunken, int size, qreal devicePixelRatio )
+    {
+
+        Oxygen::Cache<QPixmap>::Value cache( _windecoButtonLayerCache.get( color ) );
+
+        const quint64 key( ( quint64( LayerSlab ) << 32 ) | ( devicePixelRatioKey( devicePixelRatio ) << 24 ) | (sunken << 23 ) | size );
+
+        if( QPixmap *cachedPixmap = cache->object( key ) )
+        { return *cachedPixmap; }
+
+        QPixmap pixmap( windecoPixmap( size, devicePixelRatio ) );
+
+        QPainter p( &pixmap );
+        p.setRenderHints(QPainter::Antialiasing);
+        p.setPen(Qt::NoPen);
+        p.setWindow( 0, 0, 21, 21 );
+        renderWindecoSlab( p, color, sunken );
+        p.end();
+
+        cache->insert( key, new QPixmap(pixmap) );
+        return pixmap;
+
+    }
+
+    //______________________________________________________________________________
+    QPixmap DecoHelper::windecoGlyph( WindecoGlyph glyph, const QColor& color, bool contrast, int size, qreal devicePixelRatio )
+    {
+
+        Oxygen::Cache<QPixmap>::Value cache( _windecoGlyphCache.get( color ) );
+
+        const quint64 key( ( quint64( glyph ) << 40 ) | ( quint64( contrast ) << 32 ) | ( devicePixelRatioKey( devicePixelRatio ) << 24 ) | size );
+
+        if( QPixmap *cachedPixmap = cache->object( key ) )
+        { return *cachedPixmap; }
+
+        QPixmap pixmap( windecoPixmap( size, devicePixelRatio ) );
+
+        QPainter p( &pixmap );
+        p.setRenderHints(QPainter::Antialiasing);
+        p.setBrush(Qt::NoBrush);
+        if( contrast ) p.translate( 0, 1.5 );
+        renderWindecoGlyph( p, glyph, color, size );
+        p.end();
+
+        cache->insert( key, new QPixmap(pixmap) );
+        return pixmap;
+
+    }
+
+    //______________________________________________________________________________
+    void DecoHelper::renderWindecoShadow( QPainter& p, const QColor& color )
+    {
+        if( !color.isValid() ) return;
+
+        p.save();
+        p.translate( 0, -0.2 );
+        drawShadow( p, calcShadowColor( color ), 21 );
+        p.restore();
+    }
+
+    //______________________________________________________________________________
+    void DecoHelper::renderWindecoGlow( QPainter& p, const QColor& glow )
+    {
+        if( !glow.isValid() ) return;
+
+        p.save();
+        p.translate( 0, -0.2 );
+        drawOuterGlow( p, glow, 21 );
+        p.restore();
+    }
+
+    //______________________________________________________________________________
+    void DecoHelper::renderWindecoSlab( QPainter& p, const QColor& color, bool sunken )
+    {
+        if( !color.isValid() ) return;
+
+        p.save();
         p.translate( 0, 1 );
         p.setWindow( 0, 0, 18, 18 );
-        if( color.isValid() )
-        {
-            p.translate( 0, (0.5-0.668) );
+        p.translate( 0, (0.5-0.668) );
 
-            const QColor light( calcLightColor(color) );
-            const QColor dark( calcDarkColor(color) );
-
-            {
-                //plain background
-                QLinearGradient lg( 0, 1.665, 0, (12.33+1.665) );
-                if( sunken )
-                {
-                    lg.setColorAt( 1, light );
-                    lg.setColorAt( 0, dark );
-                } else {
-                    lg.setColorAt( 0, light );
-                    lg.setColorAt( 1, dark );
-                }
-
-                const QRectF r( 0.5*(18-12.33), 1.665, 12.33, 12.33 );
-                p.setBrush( lg );
-                p.drawEllipse( r );
-            }
+        const QColor light( calcLightColor(color) );
+        const QColor dark( calcDarkColor(color) );
 
+        {
+            //plain background
+            QLinearGradient lg( 0, 1.665, 0, (12.33+1.665) );
+            if( sunken )
             {
-                // outline circle
-                const qreal penWidth( 0.7 );
-                QLinearGradient lg( 0, 1.665, 0, (2.0*12.33+1.665) );
+                lg.setColorAt( 1, light );
+                lg.setColorAt( 0, dark );
+            } else {
                 lg.setColorAt( 0, light );
                 lg.setColorAt( 1, dark );
-                const QRectF r( 0.5*(18-12.33+penWidth), (1.665+penWidth), (12.33-penWidth), (12.33-penWidth) );
-                p.setPen( QPen( lg, penWidth ) );
-                p.setBrush( Qt::NoBrush );
-                p.drawEllipse( r );
             }
 
+            const QRectF r( 0.5*(18-12.33), 1.665, 12.33, 12.33 );
+            p.setBrush( lg );
+            p.drawEllipse( r );
         }
 
-        p.end();
-        cache->insert( key, new QPixmap(pixmap) );
+        {
+            // outline circle
+            const qreal penWidth( 0.7 );
+            QLinearGradient lg( 0, 1.665, 0, (2.0*12.33+1.665) );
+            lg.setColorAt( 0, light );
+            lg.setColorAt( 1, dark );
+            const QRectF r( 0.5*(18-12.33+penWidth), (1.665+penWidth), (12.33-penWidth), (12.33-penWidth) );
+            p.setPen( QPen( lg, penWidth ) );
+            p.setBrush( Qt::NoBrush );
+            p.drawEllipse( r );
+        }
+
+        p.restore();
+    }
+
+    //______________________________________________________________________________
+    void DecoHelper::renderWindecoGlyph( QPainter& p, WindecoGlyph glyph, const QColor& color, int size )
+    {
+
+        //keep all co-ordinates between 0 and 21
+        const qreal width( size );
+        p.scale( width/21, width/21 );
+
+        // make sure pen width is always larger than 1.1 in "real" coordinates
+        p.setPen( QPen( color, qMax( 1.1*21/width, 1.2 ), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin ) );
+
+        switch( glyph )
+        {
+
+            case GlyphOnAllDesktops:
+            p.drawPoint(QPointF(10.5,10.5));
+            break;
+
+            case GlyphContextHelp:
+            p.translate(1.5, 1.5);
+            p.drawArc(7,5,4,4,135*16, -180*16);
+            p.drawArc(9,8,4,4,135*16,45*16);
+            p.drawPoint(9,12);
+            p.translate(-1.5, -1.5);
+            break;
+
+            case GlyphApplicationMenu:
+            p.drawLine(QPointF(7.5, 7.5), QPointF(13.5, 7.5));
+            p.drawLine(QPointF(7.5, 10.5), QPointF(13.5, 10.5));
+            p.drawLine(QPointF(7.5, 13.5), QPointF(13.5, 13.5));
+            break;
+
+            case GlyphMinimize:
+            p.drawPolyline( QPolygonF()
+                << QPointF(7.5, 9.5)
+                << QPointF(10.5, 12.5)
+                << QPointF(13.5, 9.5) );
+            break;
+
+            case GlyphRestore:
+            p.drawPolygon( QPolygonF()
+                << QPointF(7.5, 10.5)
+                << QPointF(10.5, 7.5)
+                << QPointF(13.5, 10.5)
+                << QPointF(10.5, 13.5) );
+            break;
+
+            case GlyphMaximize:
+            p.drawPolyline( QPolygonF()
+                << QPointF(7.5, 11.5)
+                << QPointF(10.5, 8.5)
+                << QPointF(13.5, 11.5) );
+            break;
+
+            case GlyphClose:
+            p.drawLine(QPointF( 7.5,7.5), QPointF(13.5,13.5));
+            p.drawLine(QPointF(13.5,7.5), QPointF( 7.5,13.5));
+            break;
+
+            case GlyphKeepAbove:
+            p.drawPolyline( QPolygonF()
+                << QPointF( 7.5, 14)
+                << QPointF(10.5, 11)
+                << QPointF(13.5, 14) );
+
+            p.drawPolyline( QPolygonF()
+                << QPointF(7.5, 10)
+                << QPointF(10.5, 7)
+                << QPointF(13.5, 10) );
+            break;
+
+            case GlyphKeepBelow:
+            p.drawPolyline( QPolygonF()
+                << QPointF( 7.5, 11)
+                << QPointF(10.5, 14)
+                << QPointF(13.5, 11) );
+
+            p.drawPolyline( QPolygonF()
+                << QPointF(7.5, 7)
+                << QPointF(10.5, 10)
+                << QPointF(13.5, 7) );
+            break;
+
+            case GlyphShade:
+            p.drawPolyline( QPolygonF()
+                << QPointF(7.5, 7.5)
+                << QPointF(10.5, 10.5)
+                << QPointF(13.5, 7.5) );
+
+            p.drawLine(QPointF( 7.5,13.0), QPointF(13.5,13.0));
+            break;
+
+            case GlyphUnshade:
+            p.drawPolyline( QPolygonF()
+                << QPointF(7.5, 10.5)
+                << QPointF(10.5, 7.5)
+                << QPointF(13.5, 10.5) );
+
+            p.drawLine(QPointF( 7.5,13.0), QPointF(13.5,13.0));
+            break;
+
+            default:
+            break;
+        }
 
-        return pixmap;
     }
 
 }
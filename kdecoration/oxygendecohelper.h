@@ -31,13 +31,63 @@ namespace Oxygen
         void invalidateCaches() override;
 
         //* windeco buttons
-        QPixmap windecoButton(const QColor &color, const QColor& glow, bool sunken, int size = 21);
+        /** glow, if valid, is expected to be opaque. Use the separate layers below for partial glow */
+        QPixmap windecoButton(const QColor &color, const QColor& glow, bool sunken, int size = 21, qreal devicePixelRatio = 1);
+
+        //*@name windeco button layers, composited at draw time when glow is animated
+        //@{
+
+        //* shadow
+        QPixmap windecoButtonShadow( const QColor& color, int size, qreal devicePixelRatio = 1 );
+
+        //* glow, rendered opaque. Draw with painter opacity
+        QPixmap windecoButtonGlow( const QColor& glow, int size, qreal devicePixelRatio = 1 );
+
+        //* slab
+        QPixmap windecoButtonSlab( const QColor& color, bool sunken, int size, qreal devicePixelRatio = 1 );
+
+        //@}
+
+        //* windeco button glyphs
+        enum WindecoGlyph
+        {
+            GlyphNone,
+            GlyphOnAllDesktops,
+            GlyphContextHelp,
+            GlyphApplicationMenu,
+            GlyphMinimize,
+            GlyphMaximize,
+            GlyphRestore,
+            GlyphClose,
+            GlyphKeepAbove,
+            GlyphKeepBelow,
+            GlyphShade,
+            GlyphUnshade
+        };
+
+        //* windeco button glyph
+        /** contrast glyphs are shifted down, to be drawn below the main glyph */
+        QPixmap windecoGlyph( WindecoGlyph, const QColor& color, bool contrast, int size, qreal devicePixelRatio = 1 );
 
         private:
 
+        //*@name windeco button layer rendering, in a 21x21 window
+        //@{
+        void renderWindecoShadow( QPainter&, const QColor& );
+        void renderWindecoGlow( QPainter&, const QColor& );
+        void renderWindecoSlab( QPainter&, const QColor&, bool sunken );
+        void renderWindecoGlyph( QPainter&, WindecoGlyph, const QColor&, int size );
+        //@}
+
         //* windeco buttons
         Cache<QPixmap> _windecoButtonCache;
 
+        //* windeco button layers
+        Cache<QPixmap> _windecoButtonLayerCache;
+
+        //* windeco button glyphs
+        Cache<QPixmap> _windecoGlyphCache;
+
     };
 
 }
@@ -23,7 +23,9 @@
 #include <KColorUtils>
 #include <KSharedConfig>
 #include <KPluginFactory>
+#include <KWindowInfo>
 
+#include <QCache>
 #include <QPainter>
 #include <QTextStream>
 #include <QTimer>
@@ -48,10 +50,16 @@ namespace Oxygen
 
     //________________________________________________________________
     using DecorationShadowPointer = QSharedPointer<KDecoration2::DecorationShadow>;
-    using ShadowMap = QHash<int,DecorationShadowPointer>;
+
+    //* shadows shared between decorations, least recently used first evicted
+    /** cost is the shadow image size, in kilobytes */
+    using ShadowMap = QCache<int,DecorationShadowPointer>;
+
+    //* shadow cache budget, in kilobytes
+    static const int g_sShadowsMaxCost = 16*1024;
 
     static int g_sDecoCount = 0;
-    static ShadowMap g_sShadows;
+    static ShadowMap g_sShadows( g_sShadowsMaxCost );
 
     Decoration::Decoration(QObject *parent, const QVariantList &args)
         : KDecoration2::Decoration(parent, args)
@@ -206,6 +214,14 @@ namespace Oxygen
         connect(client().data(), &KDecoration2::DecoratedClient::captionChanged, this,
             [this]()
             {
+                // window title exceptions might resolve differently.
+                // Shadows do not depend on exceptions, so the shared shadow cache is kept
+                if( SettingsProvider::self()->internalSettings( this ) != m_internalSettings )
+                {
+                    applyInternalSettings();
+                    m_titleBarPixmap = QPixmap();
+                }
+
                 // update the caption area
                 update(titleBar());
             }
@@ -230,6 +246,18 @@ namespace Oxygen
 
     }
 
+    //________________________________________________________________
+    QString Decoration::windowClass() const
+    {
+        if( m_windowClass.isEmpty() )
+        {
+            KWindowInfo info( client().data()->windowId(), NET::Properties(), NET::WM2WindowClass );
+            m_windowClass = QString::fromUtf8( info.windowClassName() ) + QStringLiteral(" ") + QString::fromUtf8( info.windowClassClass() );
+        }
+
+        return m_windowClass;
+    }
+
     //________________________________________________________________
     void Decoration::updateTitleBar()
     {
@@ -306,6 +334,17 @@ namespace Oxygen
 
     //________________________________________________________________
     void Decoration::reconfigure()
+    {
+
+        applyInternalSettings();
+
+        // clear shadows
+        g_sShadows.clear();
+
+    }
+
+    //________________________________________________________________
+    void Decoration::applyInternalSettings()
     {
 
         m_internalSettings = SettingsProvider::self()->internalSettings( this );
@@ -316,9 +355,6 @@ namespace Oxygen
         // borders
         recalculateBorders();
 
-        // clear shadows
-        g_sShadows.clear();
-
         // size grip
         if( hasNoBorders() && m_internalSettings->drawSizeGrip() ) createSizeGrip();
         else deleteSizeGrip();
@@ -460,19 +496,36 @@ namespace Oxygen
     //________________________________________________________________
     void Decoration::paint(QPainter *painter, const QRect &repaintRegion)
     {
+        // cached pixmaps must match the device being painted on
+        const DevicePixelRatio::Scope devicePixelRatioScope( painter );
+
         const auto c = client().data();
         const auto palette = c->palette();
 
         const auto rect = c->isShaded() ? QRect( QPoint(0, 0), QSize(size().width(), borderTop()) ) : this->rect();
-        renderWindowBorder(painter, rect, palette);
-        if( !isMaximized() ) renderCorners( painter, rect, palette);
 
+        // title bar background, outline and caption
+        renderTitleBar( painter, rect, palette );
+
+        // remaining borders
+        const QRect bodyRect( rect.adjusted( 0, borderTop(), 0, 0 ) );
+        if( bodyRect.isValid() )
+        {
+            renderWindowBorder(painter, bodyRect, palette);
+            if( !isMaximized() )
+            {
+                painter->save();
+                painter->setClipRect( bodyRect, Qt::IntersectClip );
+                renderCorners( painter, rect, palette);
+                painter->restore();
+            }
+        }
+
+        // buttons are composited on top of the cached strip
         if( !hideTitleBar() )
         {
             m_leftButtons->paint(painter, repaintRegion);
             m_rightButtons->paint(painter, repaintRegion);
-
-            renderTitleText( painter, palette );
         }
 
     }
@@ -560,7 +613,7 @@ namespace Oxygen
         { return; }
 
         // see if shadow should be animated
-        const bool animated(
+        bool animated(
             m_animation->state() == QPropertyAnimation::Running &&
             SettingsProvider::self()->shadowCache()->isEnabled( QPalette::Active ) &&
             SettingsProvider::self()->shadowCache()->isEnabled( QPalette::Inactive )
@@ -572,37 +625,49 @@ namespace Oxygen
         key.isShade = client().data()->isShaded();
         key.hasBorder = !hasNoBorders();
 
+        qreal opacity( m_opacity );
         if( animated )
         {
 
-            static const int maxIndex = 255;
-            key.index = m_opacity * maxIndex;
+            // quantize animation. First and last steps are the static inactive and active shadows
+            const int steps( m_internalSettings->shadowAnimationSteps() );
+            const int step( qRound( m_opacity*steps ) );
+            key.active = ( step >= steps );
+            if( step > 0 && step < steps )
+            {
+                key.index = step;
+                opacity = qreal( step )/steps;
+            } else animated = false;
 
         }
 
-        const int hash( key.hash() );
+        // shadow pixmaps are rendered at the current device pixel ratio
+        const int hash( key.hash() | ( DevicePixelRatio::currentKey() << 16 ) );
 
         // find key in map
-        auto iter = g_sShadows.find( hash );
-        if( iter == g_sShadows.end() )
+        if( DecorationShadowPointer* cachedShadow = g_sShadows.object( hash ) )
         {
+            setShadow( *cachedShadow );
+            return;
+        }
 
-            auto decorationShadow = DecorationShadowPointer::create();
-            QPixmap shadowPixmap = animated ?
-                SettingsProvider::self()->shadowCache()->animatedPixmap( key, m_opacity ):
-                SettingsProvider::self()->shadowCache()->pixmap( key );
-
-            const int shadowSize( shadowPixmap.width()/2 );
-            const int overlap = 4;
-            decorationShadow->setPadding( QMargins( shadowSize-overlap, shadowSize-overlap, shadowSize-overlap, shadowSize-overlap ) );
-            decorationShadow->setInnerShadowRect( QRect( shadowSize, shadowSize, 1, 1 ) );
-            decorationShadow->setShadow( shadowPixmap.toImage() );
+        auto decorationShadow = DecorationShadowPointer::create();
+        QPixmap shadowPixmap = animated ?
+            SettingsProvider::self()->shadowCache()->animatedPixmap( key, opacity ):
+            SettingsProvider::self()->shadowCache()->pixmap( key );
 
-            iter = g_sShadows.insert( hash, decorationShadow );
+        const int shadowSize( shadowPixmap.width()/2 );
+        const int overlap = 4;
+        const QImage shadowImage( shadowPixmap.toImage() );
+        decorationShadow->setPadding( QMargins( shadowSize-overlap, shadowSize-overlap, shadowSize-overlap, shadowSize-overlap ) );
+        decorationShadow->setInnerShadowRect( QRect( shadowSize, shadowSize, 1, 1 ) );
+        decorationShadow->setShadow( shadowImage );
 
-        }
+        // account for image memory
+        const int cost( qMax<qsizetype>( 1, shadowImage.sizeInBytes()/1024 ) );
+        g_sShadows.insert( hash, new DecorationShadowPointer( decorationShadow ), cost );
 
-        setShadow( iter.value() );
+        setShadow( decorationShadow );
 
     }
 
@@ -622,6 +687,60 @@ namespace Oxygen
         painter->drawRoundedRect( QRectF( frame ).adjusted( 0.5, 0.5, -0.5, -0.5 ), 3.5,  3.5 );
     }
 
+    //_________________________________________________________
+    void Decoration::renderTitleBar( QPainter* painter, const QRect& frame, const QPalette& palette ) const
+    {
+
+        const QRect titleRect( 0, 0, frame.width(), qMin( borderTop(), frame.height() ) );
+        if( titleRect.isEmpty() ) return;
+
+        const auto c = client().data();
+        const bool hasTitle( !hideTitleBar() );
+
+        // generate key
+        TitleBarKey key;
+        key.frame = frame;
+        key.height = titleRect.height();
+        key.titleBarColor = titleBarColor( palette );
+        key.flags =
+            ( isMaximized() ? 1<<0:0 ) |
+            ( settings()->isAlphaChannelSupported() ? 1<<1:0 ) |
+            ( SettingsProvider::self()->helper()->hasBackgroundGradient( c->windowId() ) ? 1<<2:0 ) |
+            ( hasTitle ? 1<<3:0 );
+        key.devicePixelRatio = painter->device()->devicePixelRatioF();
+
+        if( hasTitle )
+        {
+            const auto cR = captionRect();
+            key.captionRect = cR.first;
+            key.alignment = cR.second;
+            key.caption = c->caption();
+            key.font = settings()->font();
+            key.fontColor = fontColor( palette );
+            key.contrastColor = contrastColor( palette );
+        }
+
+        if( m_titleBarPixmap.isNull() || !( key == m_titleBarKey ) )
+        {
+
+            m_titleBarPixmap = QPixmap( titleRect.size()*key.devicePixelRatio );
+            m_titleBarPixmap.setDevicePixelRatio( key.devicePixelRatio );
+            m_titleBarPixmap.fill( Qt::transparent );
+
+            QPainter localPainter( &m_titleBarPixmap );
+            renderWindowBorder( &localPainter, titleRect, palette );
+            if( !isMaximized() ) renderCorners( &localPainter, frame, palette );
+            if( hasTitle ) renderTitleText( &localPainter, palette );
+            localPainter.end();
+
+            m_titleBarKey = key;
+
+        }
+
+        painter->drawPixmap( titleRect.topLeft(), m_titleBarPixmap );
+
+    }
+
     //_________________________________________________________
     void Decoration::renderWindowBackground( QPainter* painter, const QRect& clipRect, const QPalette& palette ) const
     {
@@ -681,18 +800,33 @@ namespace Oxygen
         const auto c = client().data();
         const QString caption = painter->fontMetrics().elidedText(c->caption(), Qt::ElideMiddle, cR.first.width());
 
+        // layout is kept across paints, and shared by both passes.
+        // It must be prepared with the decoration font before its size is used
+        const QFont& font( settings()->font() );
+        if( m_captionText.text() != caption || m_captionFont != font )
+        {
+            m_captionText.setTextFormat( Qt::PlainText );
+            m_captionText.setText( caption );
+            m_captionText.prepare( QTransform(), font );
+            m_captionFont = font;
+        }
+
+        // position from alignment
+        const QSizeF textSize( m_captionText.size() );
+        QPointF position( cR.first.left(), cR.first.top() + ( cR.first.height() - textSize.height() )/2 );
+        if( cR.second & Qt::AlignRight ) position.rx() = cR.first.right() + 1 - textSize.width();
+        else if( cR.second & Qt::AlignHCenter ) position.rx() = cR.first.left() + ( cR.first.width() - textSize.width() )/2;
+
         const auto contrast( contrastColor( palette ) );
         if( contrast.isValid() )
         {
             painter->setPen( contrast );
-            painter->translate( 0, 1 );
-            painter->drawText( cR.first, cR.second | Qt::TextSingleLine, caption );
-            painter->translate( 0, -1 );
+            painter->drawStaticText( position + QPointF( 0, 1 ), m_captionText );
         }
 
         const auto color( fontColor( palette ) );
         painter->setPen( color );
-        painter->drawText( cR.first, cR.second | Qt::TextSingleLine, caption );
+        painter->drawStaticText( position, m_captionText );
 
     }
 
@@ -16,8 +16,11 @@
 #include <KDecoration2/DecoratedClient>
 #include <KDecoration2/DecorationSettings>
 
+#include <QFont>
 #include <QPalette>
+#include <QPixmap>
 #include <QPropertyAnimation>
+#include <QStaticText>
 #include <QVariant>
 
 namespace KDecoration2
@@ -52,6 +55,10 @@ namespace Oxygen
         InternalSettingsPtr internalSettings() const
         { return m_internalSettings; }
 
+        //* window class name and class, as matched by exceptions
+        /** retrieved from the window system once per decoration */
+        QString windowClass() const;
+
         //* caption height
         int captionHeight() const;
 
@@ -102,8 +109,14 @@ namespace Oxygen
         //* return the rect in which caption will be drawn
         QPair<QRect,Qt::Alignment> captionRect( void ) const;
 
+        //* apply per window settings, without touching the shared shadow cache
+        void applyInternalSettings();
+
         void createButtons();
 
+        //* title bar strip, cached
+        void renderTitleBar( QPainter*, const QRect&, const QPalette& ) const;
+
         //* window background
         void renderWindowBackground( QPainter*, const QRect&, const QPalette& ) const;
 
@@ -141,6 +154,54 @@ namespace Oxygen
 
         InternalSettingsPtr m_internalSettings;
 
+        //* window class, retrieved on first use
+        mutable QString m_windowClass;
+
+        //* everything the title bar strip rendering depends on
+        class TitleBarKey
+        {
+            public:
+
+            bool operator == (const TitleBarKey& other ) const
+            {
+                return
+                    frame == other.frame &&
+                    height == other.height &&
+                    captionRect == other.captionRect &&
+                    alignment == other.alignment &&
+                    caption == other.caption &&
+                    font == other.font &&
+                    titleBarColor == other.titleBarColor &&
+                    fontColor == other.fontColor &&
+                    contrastColor == other.contrastColor &&
+                    flags == other.flags &&
+                    devicePixelRatio == other.devicePixelRatio;
+            }
+
+            QRect frame;
+            int height = 0;
+            QRect captionRect;
+            int alignment = 0;
+            QString caption;
+            QFont font;
+            QColor titleBarColor;
+            QColor fontColor;
+            QColor contrastColor;
+            int flags = 0;
+            qreal devicePixelRatio = 1;
+
+        };
+
+        //* cached title bar strip
+        mutable TitleBarKey m_titleBarKey;
+        mutable QPixmap m_titleBarPixmap;
+
+        //* laid out caption
+        mutable QStaticText m_captionText;
+
+        //* font used to lay out caption
+        mutable QFont m_captionFont;
+
         QList<KDecoration2::DecorationButton*> m_buttons;
         KDecoration2::DecorationButtonGroup *m_leftButtons = nullptr;
         KDecoration2::DecorationButtonGroup *m_rightButtons = nullptr;
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenexceptionbenchmark.cpp
+// measure exception resolution time for synthetic clients
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenexceptionmatcher.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+namespace
+{
+
+    //* synthetic client
+    struct Client
+    {
+        QString className;
+        QString windowTitle;
+    };
+
+    //* exceptions, alternating window class and window title patterns
+    Oxygen::InternalSettingsList createExceptions( int count )
+    {
+        Oxygen::InternalSettingsList exceptions;
+        for( int i = 0; i < count; ++i )
+        {
+
+            Oxygen::InternalSettingsPtr exception( new Oxygen::InternalSettings() );
+            exception->setEnabled( true );
+            if( i%2 )
+            {
+
+                exception->setExceptionType( Oxygen::InternalSettings::ExceptionWindowTitle );
+                exception->setExceptionPattern( QStringLiteral( "^Document %1 - .*Editor$" ).arg( 100*i ) );
+
+            } else {
+
+                exception->setExceptionType( Oxygen::InternalSettings::ExceptionWindowClassName );
+                exception->setExceptionPattern( QStringLiteral( "^application%1 " ).arg( 100*i ) );
+
+            }
+
+            exceptions.append( exception );
+
+        }
+
+        return exceptions;
+    }
+
+    //* matching as done before exceptions were precompiled
+    Oxygen::InternalSettingsPtr matchUncompiled( const Oxygen::InternalSettingsList& exceptions, const Client& client )
+    {
+        for( const Oxygen::InternalSettingsPtr& exception : exceptions )
+        {
+            if( !exception->enabled() || exception->exceptionPattern().isEmpty() ) continue;
+            const QString& value( exception->exceptionType() == Oxygen::InternalSettings::ExceptionWindowTitle ? client.windowTitle:client.className );
+            if( value.contains( QRegularExpression( exception->exceptionPattern() ) ) ) return exception;
+        }
+
+        return Oxygen::InternalSettingsPtr();
+    }
+
+    //* print elapsed time
+    void print( QTextStream& out, const char* label, qint64 nsecs, int clientCount )
+    { out << label << ": " << nsecs/1000 << " us (" << nsecs/clientCount << " ns per client)" << "\n"; }
+
+}
+
+//__________________________________________
+int main( int argc, char** argv )
+{
+
+    QCoreApplication app( argc, argv );
+    app.setApplicationName( QStringLiteral( "oxygen-exception-benchmark" ) );
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption clientsOption( QStringLiteral( "clients" ), QStringLiteral( "number of synthetic clients" ), QStringLiteral( "count" ), QStringLiteral( "1000" ) );
+    const QCommandLineOption exceptionsOption( QStringLiteral( "exceptions" ), QStringLiteral( "number of exceptions" ), QStringLiteral( "count" ), QStringLiteral( "20" ) );
+    parser.addOption( clientsOption );
+    parser.addOption( exceptionsOption );
+    parser.process( app );
+
+    const int clientCount( qMax( 1, parser.value( clientsOption ).toInt() ) );
+    const int exceptionCount( qMax( 0, parser.value( exceptionsOption ).toInt() ) );
+
+    // few distinct applications, many distinct windows
+    QVector<Client> clients;
+    clients.reserve( clientCount );
+    for( int i = 0; i < clientCount; ++i )
+    {
+        clients.append( {
+            QStringLiteral( "application%1 Application%1" ).arg( i%50 ),
+            QStringLiteral( "Document %1 - Editor" ).arg( i ) } );
+    }
+
+    const Oxygen::InternalSettingsList exceptions( createExceptions( exceptionCount ) );
+
+    QTextStream out( stdout );
+    out
+        << "clients: " << clientCount << "\n"
+        << "exceptions: " << exceptionCount << "\n";
+
+    int matches( 0 );
+    QElapsedTimer timer;
+
+    // reference: compile every pattern for every client
+    timer.start();
+    for( const Client& client : std::as_const( clients ) )
+    { if( matchUncompiled( exceptions, client ) ) ++matches; }
+    print( out, "uncompiled", timer.nsecsElapsed(), clientCount );
+
+    // compile once, then resolve all clients
+    Oxygen::ExceptionMatcher matcher;
+    timer.restart();
+    matcher.setExceptions( exceptions );
+    for( const Client& client : std::as_const( clients ) )
+    { if( matcher.match( client.className, client.windowTitle ) ) ++matches; }
+    print( out, "compiled, first resolution", timer.nsecsElapsed(), clientCount );
+
+    // resolve again, as on decoration reconfiguration
+    timer.restart();
+    for( const Client& client : std::as_const( clients ) )
+    { if( matcher.match( client.className, client.windowTitle ) ) ++matches; }
+    print( out, "compiled, memoized", timer.nsecsElapsed(), clientCount );
+
+    // caption changes invalidate the memoized value for that client
+    for( Client& client : clients ) client.windowTitle.prepend( QLatin1Char( '*' ) );
+    timer.restart();
+    for( const Client& client : std::as_const( clients ) )
+    { if( matcher.match( client.className, client.windowTitle ) ) ++matches; }
+    print( out, "compiled, after caption change", timer.nsecsElapsed(), clientCount );
+
+    out << "matches: " << matches << "\n";
+    return 0;
+
+}
@@ -0,0 +1,84 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenexceptionmatcher.cpp
+// match windows against precompiled decoration exceptions
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenexceptionmatcher.h"
+
+namespace Oxygen
+{
+
+    //* maximum number of memoized matches
+    static const int maxMatches = 4096;
+
+    //______________________________________________________________
+    void ExceptionMatcher::setExceptions( const InternalSettingsList& exceptions )
+    {
+
+        _exceptions.clear();
+        _matches.clear();
+        _hasClassNameExceptions = false;
+        _hasTitleExceptions = false;
+
+        for( const InternalSettingsPtr& settings : exceptions )
+        {
+
+            // discard disabled exceptions
+            if( !settings->enabled() ) continue;
+
+            // discard exceptions with empty exception pattern
+            if( settings->exceptionPattern().isEmpty() ) continue;
+
+            Exception exception;
+            exception._settings = settings;
+            exception._matchTitle = ( settings->exceptionType() == InternalSettings::ExceptionWindowTitle );
+            exception._expression = QRegularExpression( settings->exceptionPattern() );
+            exception._expression.optimize();
+
+            if( exception._matchTitle ) _hasTitleExceptions = true;
+            else _hasClassNameExceptions = true;
+
+            _exceptions.append( exception );
+
+        }
+
+    }
+
+    //______________________________________________________________
+    InternalSettingsPtr ExceptionMatcher::match( const QString& className, const QString& windowTitle ) const
+    {
+
+        if( _exceptions.isEmpty() ) return InternalSettingsPtr();
+
+        // values that no exception looks at are left out of the key
+        const Key key(
+            _hasClassNameExceptions ? className:QString(),
+            _hasTitleExceptions ? windowTitle:QString() );
+
+        auto iter( _matches.constFind( key ) );
+        if( iter != _matches.constEnd() ) return iter.value();
+
+        InternalSettingsPtr out;
+        for( const Exception& exception : _exceptions )
+        {
+            const QString& value( exception._matchTitle ? windowTitle:className );
+            if( value.contains( exception._expression ) )
+            {
+                out = exception._settings;
+                break;
+            }
+        }
+
+        // titles change frequently. Keep memory bounded
+        if( _matches.size() >= maxMatches ) _matches.clear();
+        _matches.insert( key, out );
+        return out;
+
+    }
+
+}
@@ -0,0 +1,85 @@
+#ifndef oxygenexceptionmatcher_h
+#define oxygenexceptionmatcher_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenexceptionmatcher.h
+// match windows against precompiled decoration exceptions
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygensettings.h"
+#include "oxygen.h"
+
+#include <QHash>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+
+namespace Oxygen
+{
+
+    //* match windows against exceptions
+    /*!
+    exception patterns are compiled once, when exceptions are set,
+    and the matching exception is memoized per window class and title
+    */
+    class ExceptionMatcher
+    {
+
+        public:
+
+        //* set exceptions
+        /** disabled exceptions and exceptions with empty patterns are discarded */
+        void setExceptions( const InternalSettingsList& );
+
+        //* true if some exceptions match on window class name
+        bool hasClassNameExceptions( void ) const
+        { return _hasClassNameExceptions; }
+
+        //* true if some exceptions match on window title
+        bool hasTitleExceptions( void ) const
+        { return _hasTitleExceptions; }
+
+        //* first exception matching given window class and title, or null pointer
+        InternalSettingsPtr match( const QString& className, const QString& windowTitle ) const;
+
+        private:
+
+        //* compiled exception
+        class Exception
+        {
+            public:
+
+            //* settings
+            InternalSettingsPtr _settings;
+
+            //* true if matching window title, false if matching window class
+            bool _matchTitle = false;
+
+            //* compiled pattern
+            QRegularExpression _expression;
+
+        };
+
+        //* compiled exceptions
+        QVector<Exception> _exceptions;
+
+        //* true if some exceptions match on window class name
+        bool _hasClassNameExceptions = false;
+
+        //* true if some exceptions match on window title
+        bool _hasTitleExceptions = false;
+
+        //* memoized matches, per window class and title
+        using Key = QPair<QString, QString>;
+        mutable QHash<Key, InternalSettingsPtr> _matches;
+
+    };
+
+}
+
+#endif
@@ -12,9 +12,6 @@
 
 #include "oxygenexceptionlist.h"
 
-#include <KWindowInfo>
-
-#include <QRegularExpression>
 #include <QTextStream>
 
 namespace Oxygen
@@ -64,7 +61,7 @@ namespace Oxygen
 
         ExceptionList exceptions;
         exceptions.readConfig( m_config );
-        m_exceptions = exceptions.get();
+        m_exceptions.setExceptions( exceptions.get() );
 
     }
 
@@ -72,59 +69,12 @@ namespace Oxygen
     InternalSettingsPtr SettingsProvider::internalSettings(const Decoration *decoration ) const
     {
 
-        QString windowTitle;
-        QString className;
-
-        // get the client
-        auto client = decoration->client().data();
-
-        for ( auto internalSettings : std::as_const(m_exceptions) )
-        {
-
-            // discard disabled exceptions
-            if( !internalSettings->enabled() ) continue;
-
-            // discard exceptions with empty exception pattern
-            if( internalSettings->exceptionPattern().isEmpty() ) continue;
-
-            /*
-            decide which value is to be compared
-            to the regular expression, based on exception type
-            */
-            QString value;
-            switch( internalSettings->exceptionType() )
-            {
-                case InternalSettings::ExceptionWindowTitle:
-                {
-                    value = windowTitle.isEmpty() ? (windowTitle = client->caption()):windowTitle;
-                    break;
-                }
-
-                default:
-                case InternalSettings::ExceptionWindowClassName:
-                {
-                    if( className.isEmpty() )
-                    {
-                        // retrieve class name
-                        KWindowInfo info( client->windowId(), 0, NET::WM2WindowClass );
-                        QString window_className( QString::fromUtf8(info.windowClassName()) );
-                        QString window_class( QString::fromUtf8(info.windowClassClass()) );
-                        className = window_className + QStringLiteral(" ") + window_class;
-                    }
-
-                    value = className;
-                    break;
-                }
-
-            }
-
-            // check matching
-            if(value.contains(QRegularExpression( internalSettings->exceptionPattern() )))
-            { return internalSettings; }
-
-        }
+        // only retrieve the values exceptions actually look at
+        const QString className( m_exceptions.hasClassNameExceptions() ? decoration->windowClass():QString() );
+        const QString windowTitle( m_exceptions.hasTitleExceptions() ? decoration->client().data()->caption():QString() );
 
-        return m_defaultSettings;
+        const InternalSettingsPtr exception( m_exceptions.match( className, windowTitle ) );
+        return exception ? exception:m_defaultSettings;
 
     }
 
@@ -8,6 +8,7 @@
  */
 
 #include "oxygendecoration.h"
+#include "oxygenexceptionmatcher.h"
 #include "oxygen.h"
 
 #include <KSharedConfig>
@@ -56,8 +57,8 @@ namespace Oxygen
         //* default configuration
         InternalSettingsPtr m_defaultSettings;
 
-        //* exceptions
-        InternalSettingsList m_exceptions;
+        //* exceptions, compiled
+        ExceptionMatcher m_exceptions;
 
         //* config object
         KSharedConfigPtr m_config;
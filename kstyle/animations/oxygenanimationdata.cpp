@@ -17,14 +17,13 @@ namespace Oxygen
     int AnimationData::_steps = 0;
 
     //_________________________________________________________________________________
-    void AnimationData::setupAnimation( const Animation::Pointer& animation, const QByteArray& property )
+    void AnimationData::setupAnimation( const Animation::Pointer& animation, Animation::Setter setter )
     {
 
         // setup animation
         animation.data()->setStartValue( 0.0 );
         animation.data()->setEndValue( 1.0 );
-        animation.data()->setTargetObject( this );
-        animation.data()->setPropertyName( property );
+        animation.data()->setTarget( this, std::move( setter ) );
 
     }
 
@@ -72,7 +72,11 @@ namespace Oxygen
         protected:
 
         //* setup animation
-        virtual void setupAnimation( const Animation::Pointer& animation, const QByteArray& property );
+        virtual void setupAnimation( const Animation::Pointer& animation, Animation::Setter setter );
+
+        //* setup animation, passing values to a setter of a derived class
+        template<typename T> void setupAnimation( const Animation::Pointer& animation, void (T::*setter)( qreal ) )
+        { setupAnimation( animation, [this, setter]( qreal value ) { (static_cast<T*>( this )->*setter)( value ); } ); }
 
         //* apply step
         virtual qreal digitize( const qreal& value ) const
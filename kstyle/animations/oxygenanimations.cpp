@@ -13,7 +13,9 @@
 #include "oxygenanimations.h"
 #include "oxygenpropertynames.h"
 #include "oxygenstyleconfigdata.h"
+#include "oxygenwidgettraits.h"
 
+#include <QAbstractAnimation>
 #include <QAbstractItemView>
 #include <QComboBox>
 #include <QDial>
@@ -234,19 +236,20 @@ namespace Oxygen
 
         // these are needed to not register animations for kwin widgets
         if( widget->objectName() == QStringLiteral( "decoration widget" ) ) return;
-        if( widget->inherits( "KCommonDecorationButton" ) ) return;
-        if( widget->inherits( "QShapedPixmapWidget" ) ) return;
+        const WidgetTraits traits( WidgetTraits::get( widget ) );
+        if( traits.is( WidgetTraits::KCommonDecorationButton ) ) return;
+        if( traits.is( WidgetTraits::ShapedPixmapWidget ) ) return;
 
         // all widgets are registered to the enability engine.
         _widgetEnableStateEngine->registerWidget( widget, AnimationEnable );
 
         // install animation timers
         // for optimization, one should put with most used widgets here first
-        if( qobject_cast<QToolButton*>(widget) )
+        if( traits.is( WidgetTraits::ToolButton ) )
         {
 
             _toolButtonEngine->registerWidget( widget, AnimationHover );
-            bool isInToolBar( qobject_cast<QToolBar*>(widget->parent()) );
+            bool isInToolBar( WidgetTraits::get( widget->parent() ).is( WidgetTraits::ToolBar ) );
             if( isInToolBar )
             {
 
@@ -255,70 +258,70 @@ namespace Oxygen
 
             } else _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus );
 
-        } else if( qobject_cast<QAbstractButton*>(widget) ) {
+        } else if( traits.is( WidgetTraits::AbstractButton ) ) {
 
-            if( qobject_cast<QToolBox*>( widget->parent() ) )
+            if( WidgetTraits::get( widget->parent() ).is( WidgetTraits::ToolBox ) )
             { _toolBoxEngine->registerWidget( widget ); }
 
             _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus );
 
-        } else if( qobject_cast<QDial*>(widget) ) {
+        } else if( traits.is( WidgetTraits::Dial ) ) {
 
             _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus );
 
         }
 
         // groupboxes
-        else if( QGroupBox* groupBox = qobject_cast<QGroupBox*>( widget ) )
+        else if( traits.is( WidgetTraits::GroupBox ) )
         {
-            if( groupBox->isCheckable() )
+            if( static_cast<QGroupBox*>( widget )->isCheckable() )
             { _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
         }
 
         // scrollbar
-        else if( qobject_cast<QScrollBar*>( widget ) ) { _scrollBarEngine->registerWidget( widget ); }
-        else if( qobject_cast<QSlider*>( widget ) ) { _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( qobject_cast<QProgressBar*>( widget ) )
+        else if( traits.is( WidgetTraits::ScrollBar ) ) { _scrollBarEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::Slider ) ) { _widgetStateEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( traits.is( WidgetTraits::ProgressBar ) )
         {
             _progressBarEngine->registerWidget( widget );
             _busyIndicatorEngine->registerWidget( widget );
         }
-        else if( qobject_cast<QSplitterHandle*>( widget ) ) { _splitterEngine->registerWidget( widget ); }
-        else if( qobject_cast<QMainWindow*>( widget ) ) { _dockSeparatorEngine->registerWidget( widget ); }
-        else if( qobject_cast<QHeaderView*>( widget ) ) { _headerViewEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::SplitterHandle ) ) { _splitterEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::MainWindow ) ) { _dockSeparatorEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::HeaderView ) ) { _headerViewEngine->registerWidget( widget ); }
 
         // menu
-        else if( qobject_cast<QMenu*>( widget ) ) { _menuEngine->registerWidget( widget ); }
-        else if( qobject_cast<QMenuBar*>( widget ) ) { _menuBarEngine->registerWidget( widget ); }
-        else if( qobject_cast<QTabBar*>( widget ) ) { _tabBarEngine->registerWidget( widget ); }
-        else if( qobject_cast<QToolBar*>( widget ) ) { _toolBarEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::Menu ) ) { _menuEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::MenuBar ) ) { _menuBarEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::TabBar ) ) { _tabBarEngine->registerWidget( widget ); }
+        else if( traits.is( WidgetTraits::ToolBar ) ) { _toolBarEngine->registerWidget( widget ); }
 
         // editors
-        else if( qobject_cast<QComboBox*>( widget ) ) {
+        else if( traits.is( WidgetTraits::ComboBox ) ) {
             _comboBoxEngine->registerWidget( widget, AnimationHover );
             _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus );
-        } else if( qobject_cast<QSpinBox*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::SpinBox ) ) {
             _spinBoxEngine->registerWidget( widget );
             _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus );
         }
-        else if( qobject_cast<QLineEdit*>( widget ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( qobject_cast<QTextEdit*>( widget ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
-        else if( widget->inherits( "KTextEditor::View" ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( traits.is( WidgetTraits::LineEdit ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( traits.is( WidgetTraits::TextEdit ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
+        else if( traits.is( WidgetTraits::KTextEditorView ) ) { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         // lists
-        else if( qobject_cast<QAbstractItemView*>( widget ) )
+        else if( traits.is( WidgetTraits::AbstractItemView ) )
         { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         // scrollarea
-        else if( QAbstractScrollArea* scrollArea = qobject_cast<QAbstractScrollArea*>( widget ) ) {
+        else if( traits.is( WidgetTraits::AbstractScrollArea ) ) {
 
-            if( scrollArea->frameShadow() == QFrame::Sunken && (widget->focusPolicy()&Qt::StrongFocus) )
+            if( static_cast<QAbstractScrollArea*>( widget )->frameShadow() == QFrame::Sunken && (widget->focusPolicy()&Qt::StrongFocus) )
             { _inputWidgetEngine->registerWidget( widget, AnimationHover|AnimationFocus ); }
 
         }
 
         // mdi subwindows
-        else if( qobject_cast<QMdiSubWindow*>( widget ) )
+        else if( traits.is( WidgetTraits::MdiSubWindow ) )
         { _mdiWindowEngine->registerWidget( widget ); }
 
         return;
@@ -351,6 +354,41 @@ namespace Oxygen
 
     }
 
+    //____________________________________________________________
+    void Animations::memoryFootprint( MemoryFootprint& footprint ) const
+    {
+
+        // several engines share the same class, so they are named explicitly
+        const QString category( QStringLiteral( "animations" ) );
+        const QList<QPair<QString, const BaseEngine*>> engines =
+        {
+            { QStringLiteral( "busyIndicator" ), _busyIndicatorEngine },
+            { QStringLiteral( "dockSeparator" ), _dockSeparatorEngine },
+            { QStringLiteral( "headerView" ), _headerViewEngine },
+            { QStringLiteral( "widgetEnableState" ), _widgetEnableStateEngine },
+            { QStringLiteral( "widgetState" ), _widgetStateEngine },
+            { QStringLiteral( "comboBox" ), _comboBoxEngine },
+            { QStringLiteral( "toolButton" ), _toolButtonEngine },
+            { QStringLiteral( "inputWidget" ), _inputWidgetEngine },
+            { QStringLiteral( "splitter" ), _splitterEngine },
+            { QStringLiteral( "progressBar" ), _progressBarEngine },
+            { QStringLiteral( "menuBar" ), _menuBarEngine },
+            { QStringLiteral( "menu" ), _menuEngine },
+            { QStringLiteral( "scrollBar" ), _scrollBarEngine },
+            { QStringLiteral( "spinBox" ), _spinBoxEngine },
+            { QStringLiteral( "tabBar" ), _tabBarEngine },
+            { QStringLiteral( "toolBar" ), _toolBarEngine },
+            { QStringLiteral( "toolBox" ), _toolBoxEngine },
+            { QStringLiteral( "mdiWindow" ), _mdiWindowEngine }
+        };
+
+        for( const auto& engine:engines )
+        { footprint.add( category, engine.first, engine.second->dataCount() ); }
+
+        footprint.add( category, QStringLiteral( "animationObjects" ), findChildren<QAbstractAnimation*>().size() );
+
+    }
+
     //_______________________________________________________________
     void Animations::unregisterEngine( QObject* object )
     {
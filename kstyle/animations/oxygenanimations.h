@@ -15,6 +15,7 @@
 #include "oxygendockseparatorengine.h"
 #include "oxygenheaderviewengine.h"
 #include "oxygenmdiwindowengine.h"
+#include "oxygenmemoryfootprint.h"
 #include "oxygenmenubarengine.h"
 #include "oxygenmenuengine.h"
 #include "oxygenprogressbarengine.h"
@@ -49,6 +50,9 @@ namespace Oxygen
         /** unregister all animations associated to a widget */
         void unregisterWidget( QWidget* widget ) const;
 
+        //* add number of data objects per engine to report
+        void memoryFootprint( MemoryFootprint& ) const;
+
         //* enable state engine
         WidgetStateEngine& widgetEnableStateEngine( void ) const
         { return *_widgetEnableStateEngine; }
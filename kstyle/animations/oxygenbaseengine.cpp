@@ -9,3 +9,20 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenbaseengine.h"
+
+namespace Oxygen
+{
+
+    //____________________________________________________________
+    int BaseEngine::dataCount( void ) const
+    {
+        // data objects are created with the engine as parent
+        int out( 0 );
+        const auto children( findChildren<QObject*>( QString(), Qt::FindDirectChildrenOnly ) );
+        for( const QObject* child:children )
+        { if( child->inherits( "Oxygen::AnimationData" ) || child->inherits( "Oxygen::TransitionData" ) ) ++out; }
+
+        return out;
+    }
+
+}
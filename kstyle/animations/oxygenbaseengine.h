@@ -54,6 +54,9 @@ namespace Oxygen
         virtual WidgetList registeredWidgets( void ) const
         { return WidgetList(); }
 
+        //* number of animation or transition data objects owned by the engine
+        int dataCount( void ) const;
+
         //@}
 
         //*@name modifiers
@@ -84,8 +84,7 @@ namespace Oxygen
                     // setup
                     _animation.data()->setStartValue( 0 );
                     _animation.data()->setEndValue( 1 );
-                    _animation.data()->setTargetObject( this );
-                    _animation.data()->setPropertyName( "value" );
+                    _animation.data()->setTarget( this, &BusyIndicatorEngine::setValue );
                     _animation.data()->setLoopCount( -1 );
                     _animation.data()->setDuration( duration()*100 );
 
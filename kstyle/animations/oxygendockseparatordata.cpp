@@ -23,15 +23,13 @@ namespace Oxygen
         _horizontalData._animation = new Animation( duration, this );
         _horizontalData._animation.data()->setStartValue( 0.0 );
         _horizontalData._animation.data()->setEndValue( 1.0 );
-        _horizontalData._animation.data()->setTargetObject( this );
-        _horizontalData._animation.data()->setPropertyName( "horizontalOpacity" );
+        _horizontalData._animation.data()->setTarget( this, &DockSeparatorData::setHorizontalOpacity );
 
         // setup animation
         _verticalData._animation = new Animation( duration, this );
         _verticalData._animation.data()->setStartValue( 0.0 );
         _verticalData._animation.data()->setEndValue( 1.0 );
-        _verticalData._animation.data()->setTargetObject( this );
-        _verticalData._animation.data()->setPropertyName( "verticalOpacity" );
+        _verticalData._animation.data()->setTarget( this, &DockSeparatorData::setVerticalOpacity );
 
     }
 
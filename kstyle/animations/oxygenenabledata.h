@@ -12,6 +12,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenwidgetstatedata.h"
+#include "oxygeneventdispatcher.h"
 
 namespace Oxygen
 {
@@ -27,7 +28,7 @@ namespace Oxygen
         //* constructor
         EnableData( QObject* parent, QWidget* target, int duration, bool state = true ):
         WidgetStateData( parent, target, duration, state )
-        { target->installEventFilter( this ); }
+        { EventDispatcher::instance().subscribe( target, this, { QEvent::EnabledChange } ); }
 
         //* event filter
         bool eventFilter( QObject*, QEvent* ) override;
@@ -18,6 +18,6 @@ namespace Oxygen
     GenericData::GenericData( QObject* parent, QWidget* target, int duration ):
         AnimationData( parent, target ),
         _animation( new Animation( duration, this ) )
-    { setupAnimation( _animation, "opacity" ); }
+    { setupAnimation( _animation, &GenericData::setOpacity ); }
 
 }
@@ -24,11 +24,11 @@ namespace Oxygen
     {
 
         _current._animation = new Animation( duration, this );
-        setupAnimation( currentIndexAnimation(), "currentOpacity" );
+        setupAnimation( currentIndexAnimation(), &HeaderViewData::setCurrentOpacity );
         currentIndexAnimation().data()->setDirection( Animation::Forward );
 
         _previous._animation = new Animation( duration, this );
-        setupAnimation( previousIndexAnimation(), "previousOpacity" );
+        setupAnimation( previousIndexAnimation(), &HeaderViewData::setPreviousOpacity );
         previousIndexAnimation().data()->setDirection( Animation::Backward );
 
     }
@@ -19,8 +19,8 @@ namespace Oxygen
     {
         _currentData._animation = new Animation( duration, this );
         _previousData._animation = new Animation( duration, this );
-        setupAnimation( currentAnimation(), "currentOpacity" );
-        setupAnimation( previousAnimation(), "previousOpacity" );
+        setupAnimation( currentAnimation(), &MdiWindowData::setCurrentOpacity );
+        setupAnimation( previousAnimation(), &MdiWindowData::setPreviousOpacity );
 
         currentAnimation().data()->setDirection( Animation::Forward );
         previousAnimation().data()->setDirection( Animation::Backward );
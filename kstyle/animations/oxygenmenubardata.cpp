@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenmenubardata.h"
+#include "oxygeneventdispatcher.h"
 
 #include <QTextStream>
 
@@ -27,15 +28,15 @@ namespace Oxygen
         MenuBarData( parent, target )
     {
 
-        target->installEventFilter( this );
+        EventDispatcher::instance().subscribe( target, this, { QEvent::Enter, QEvent::Leave, QEvent::MouseMove, QEvent::MouseButtonPress } );
 
         // setup timeLine
         _current._animation = new Animation( duration, this );
-        setupAnimation( currentAnimation(), "currentOpacity" );
+        setupAnimation( currentAnimation(), &MenuBarDataV1::setCurrentOpacity );
         currentAnimation().data()->setDirection( Animation::Forward );
 
         _previous._animation = new Animation( duration, this );
-        setupAnimation( previousAnimation(), "previousOpacity" );
+        setupAnimation( previousAnimation(), &MenuBarDataV1::setPreviousOpacity );
         previousAnimation().data()->setDirection( Animation::Backward );
 
     }
@@ -106,21 +107,19 @@ namespace Oxygen
         _entered( true )
     {
 
-        target->installEventFilter( this );
+        EventDispatcher::instance().subscribe( target, this, { QEvent::Enter, QEvent::Hide, QEvent::Leave, QEvent::MouseMove } );
 
         _animation = new Animation( duration, this );
         animation().data()->setDirection( Animation::Forward );
         animation().data()->setStartValue( 0.0 );
         animation().data()->setEndValue( 1.0 );
-        animation().data()->setTargetObject( this );
-        animation().data()->setPropertyName( "opacity" );
+        animation().data()->setTarget( this, &MenuBarDataV2::setOpacity );
 
         _progressAnimation = new Animation( duration, this );
         progressAnimation().data()->setDirection( Animation::Forward );
         progressAnimation().data()->setStartValue( 0 );
         progressAnimation().data()->setEndValue( 1 );
-        progressAnimation().data()->setTargetObject( this );
-        progressAnimation().data()->setPropertyName( "progress" );
+        progressAnimation().data()->setTarget( this, &MenuBarDataV2::setProgress );
         progressAnimation().data()->setEasingCurve( QEasingCurve::Linear );
 
     }
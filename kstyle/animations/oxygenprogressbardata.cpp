@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenprogressbardata.h"
+#include "oxygeneventdispatcher.h"
 
 #include <QProgressBar>
 
@@ -22,7 +23,7 @@ namespace Oxygen
         _endValue(0)
     {
 
-        target->installEventFilter( this );
+        EventDispatcher::instance().subscribe( target, this, { QEvent::Show, QEvent::Hide } );
 
         // set animation curve shape
         animation().data()->setEasingCurve( QEasingCurve::InOutQuad );
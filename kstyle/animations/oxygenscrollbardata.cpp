@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenscrollbardata.h"
+#include "oxygeneventdispatcher.h"
 
 #include <QHoverEvent>
 #include <QScrollBar>
@@ -25,7 +26,7 @@ namespace Oxygen
         _position( -1, -1 )
     {
 
-        target->installEventFilter( this );
+        EventDispatcher::instance().subscribe( target, this, { QEvent::HoverEnter, QEvent::HoverMove, QEvent::HoverLeave } );
 
         _addLineData._animation = new Animation( duration, this );
         _subLineData._animation = new Animation( duration, this );
@@ -34,8 +35,8 @@ namespace Oxygen
         connect( subLineAnimation().data(), SIGNAL(finished()), SLOT(clearSubLineRect()) );
 
         // setup animation
-        setupAnimation( addLineAnimation(), "addLineOpacity" );
-        setupAnimation( subLineAnimation(), "subLineOpacity" );
+        setupAnimation( addLineAnimation(), &ScrollBarData::setAddLineOpacity );
+        setupAnimation( subLineAnimation(), &ScrollBarData::setSubLineOpacity );
 
     }
 
@@ -19,8 +19,8 @@ namespace Oxygen
     {
         _upArrowData._animation = new Animation( duration, this );
         _downArrowData._animation = new Animation( duration, this );
-        setupAnimation( upArrowAnimation(), "upArrowOpacity" );
-        setupAnimation( downArrowAnimation(), "downArrowOpacity" );
+        setupAnimation( upArrowAnimation(), &SpinBoxData::setUpArrowOpacity );
+        setupAnimation( downArrowAnimation(), &SpinBoxData::setDownArrowOpacity );
     }
 
     //______________________________________________
@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygentoolbardata.h"
+#include "oxygeneventdispatcher.h"
 
 #include <QToolButton>
 
@@ -24,22 +25,20 @@ namespace Oxygen
         _entered( false )
     {
 
-        target->installEventFilter( this );
+        EventDispatcher::instance().subscribe( target, this, { QEvent::Enter, QEvent::ChildAdded } );
 
         _animation = new Animation( duration, this );
         animation().data()->setDirection( Animation::Forward );
         animation().data()->setStartValue( 0.0 );
         animation().data()->setEndValue( 1.0 );
-        animation().data()->setTargetObject( this );
-        animation().data()->setPropertyName( "opacity" );
+        animation().data()->setTarget( this, &ToolBarData::setOpacity );
 
         // progress animation
         _progressAnimation = new Animation( duration, this );
         progressAnimation().data()->setDirection( Animation::Forward );
         progressAnimation().data()->setStartValue( 0 );
         progressAnimation().data()->setEndValue( 1 );
-        progressAnimation().data()->setTargetObject( this );
-        progressAnimation().data()->setPropertyName( "progress" );
+        progressAnimation().data()->setTarget( this, &ToolBarData::setProgress );
         progressAnimation().data()->setEasingCurve( QEasingCurve::Linear );
 
         // add all children widgets to event handler
@@ -256,12 +255,11 @@ namespace Oxygen
         if( !widget ) return;
 
         // add connections
-        connect( animation().data(), SIGNAL(valueChanged(QVariant)), widget, SLOT(update()), Qt::UniqueConnection  );
-        connect( progressAnimation().data(), SIGNAL(valueChanged(QVariant)), widget, SLOT(update()), Qt::UniqueConnection  );
+        connect( animation().data(), SIGNAL(valueChanged(qreal)), widget, SLOT(update()), Qt::UniqueConnection  );
+        connect( progressAnimation().data(), SIGNAL(valueChanged(qreal)), widget, SLOT(update()), Qt::UniqueConnection  );
 
         // add event filter
-        widget->removeEventFilter( this );
-        widget->installEventFilter( this );
+        EventDispatcher::instance().subscribe( widget, this, { QEvent::HoverEnter, QEvent::HoverLeave } );
     }
 
     //___________________________________________________________
@@ -0,0 +1,354 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenprofiler.cpp
+// per element paint time profiler
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenprofiler.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMetaEnum>
+#include <QMutexLocker>
+#include <QSocketNotifier>
+#include <QTextStream>
+#include <QThread>
+
+#include <algorithm>
+
+#ifdef Q_OS_UNIX
+#include <csignal>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace Oxygen
+{
+
+    std::atomic<bool> Profiler::_enabled( false );
+    QPointer<Profiler> Profiler::_instance;
+
+    namespace
+    {
+
+        //* innermost measured scope, per thread
+        thread_local Profiler::Scope* currentScope = nullptr;
+
+        //* maximum number of recorded trace events
+        const int maxEvents = 1<<20;
+
+        //* histogram sub-buckets per power of two
+        const int subBuckets = 8;
+
+        //* histogram size, covering all positive 64 bits durations
+        const int histogramSize = 2*subBuckets + ( 64 - 4 )*subBuckets;
+
+        //* histogram bucket for a given duration. Values below 16 get their own bucket, larger values one eighth of an octave
+        int bucket( qint64 value )
+        {
+            if( value < 2*subBuckets ) return int( qMax<qint64>( 0, value ) );
+            const int exponent( 63 - qCountLeadingZeroBits( quint64( value ) ) );
+            return 2*subBuckets + ( exponent - 4 )*subBuckets + int( ( value >> ( exponent - 3 ) ) & ( subBuckets - 1 ) );
+        }
+
+        //* upper bound of a given bucket
+        qint64 bucketValue( int index )
+        {
+            if( index < 2*subBuckets ) return index;
+            const int exponent( ( index - 2*subBuckets )/subBuckets + 4 );
+            const int sub( ( index - 2*subBuckets )%subBuckets );
+            return ( qint64( subBuckets + sub + 1 ) << ( exponent - 3 ) ) - 1;
+        }
+
+        //* tile names, matching Profiler::TileType
+        const char* const tileNames[] =
+        {
+            "DockWidgetButton",
+            "RoundCorner",
+            "Slope",
+            "Slab",
+            "SlabSunken",
+            "ProgressBarIndicator",
+            "DialSlab",
+            "RoundSlab",
+            "SliderSlab",
+            "HoleFlat",
+            "ScrollHole",
+            "ScrollHandle",
+            "SlitFocused",
+            "DockFrame",
+            "Selection",
+            "TabTear",
+            "Hole"
+        };
+
+        //* trace category, from kind
+        const char* category( Profiler::Kind kind )
+        {
+            switch( kind )
+            {
+                case Profiler::Primitive: return "primitive";
+                case Profiler::Control: return "control";
+                case Profiler::ComplexControl: return "complexcontrol";
+                case Profiler::Tile: default: return "tile";
+            }
+        }
+
+        #ifdef Q_OS_UNIX
+        //* sockets used to forward SIGUSR1 to the event loop
+        int signalSockets[2] = { -1, -1 };
+
+        //* signal handler. Only async-signal-safe calls are allowed here
+        void signalHandler( int )
+        {
+            const char value( 1 );
+            const ssize_t written( ::write( signalSockets[0], &value, sizeof( value ) ) );
+            Q_UNUSED( written );
+        }
+        #endif
+
+    }
+
+    //________________________________________________
+    void Profiler::Record::add( qint64 duration, qint64 missTime )
+    {
+        if( _histogram.isEmpty() ) _histogram.resize( histogramSize );
+
+        ++_calls;
+        _total += duration;
+        _max = qMax( _max, duration );
+        _missTime += missTime;
+        ++_histogram[bucket( duration )];
+    }
+
+    //________________________________________________
+    qint64 Profiler::Record::percentile( qreal fraction ) const
+    {
+        const quint64 target( qMax<quint64>( 1, quint64( fraction*_calls + 0.5 ) ) );
+        quint64 count( 0 );
+        for( int i = 0; i < _histogram.size(); ++i )
+        {
+            count += _histogram[i];
+            if( count >= target ) return qMin( _max, bucketValue( i ) );
+        }
+
+        return _max;
+    }
+
+    //________________________________________________
+    void Profiler::Scope::start( Kind kind, int element )
+    {
+        Profiler* profiler( instance() );
+        if( !profiler ) return;
+
+        _key = ( quint64( kind ) << 32 ) | quint32( element );
+        _parent = currentScope;
+        currentScope = this;
+        _start = profiler->_timer.nsecsElapsed();
+    }
+
+    //________________________________________________
+    void Profiler::Scope::stop( void )
+    {
+        currentScope = _parent;
+
+        Profiler* profiler( _instance.data() );
+        if( !profiler ) return;
+
+        const qint64 duration( profiler->_timer.nsecsElapsed() - _start );
+
+        // time spent in tile builders is accounted as cache miss time of all enclosing elements
+        if( _parent ) _parent->_missTime += ( ( _key >> 32 ) == Tile ) ? duration : _missTime;
+
+        profiler->record( _key, _start, duration, _missTime );
+    }
+
+    //________________________________________________
+    Profiler::Profiler( QObject* parent ):
+        QObject( parent ),
+        _traceFile( qEnvironmentVariable( "OXYGEN_PROFILE_TRACE" ) )
+    {
+        _timer.start();
+        connect( qApp, &QCoreApplication::aboutToQuit, this, &Profiler::dump );
+        installSignalHandler();
+    }
+
+    //________________________________________________
+    Profiler* Profiler::instance( void )
+    {
+        if( !_instance && QCoreApplication::instance() && QThread::currentThread() == qApp->thread() )
+        { _instance = new Profiler( qApp ); }
+
+        return _instance.data();
+    }
+
+    //________________________________________________
+    void Profiler::initialize( void )
+    { if( qEnvironmentVariableIntValue( "OXYGEN_PROFILE" ) ) setEnabled( true ); }
+
+    //________________________________________________
+    void Profiler::setEnabled( bool value )
+    {
+        if( value && !instance() ) return;
+        _enabled.store( value, std::memory_order_relaxed );
+    }
+
+    //________________________________________________
+    void Profiler::dump( void )
+    {
+        Profiler* profiler( _instance.data() );
+        if( !profiler ) return;
+
+        profiler->report();
+        profiler->writeTrace();
+    }
+
+    //________________________________________________
+    void Profiler::installSignalHandler( void )
+    {
+
+        #ifdef Q_OS_UNIX
+
+        // do not override a handler installed by the application
+        struct sigaction current;
+        if( ::sigaction( SIGUSR1, nullptr, &current ) != 0 || current.sa_handler != SIG_DFL ) return;
+        if( ::socketpair( AF_UNIX, SOCK_STREAM, 0, signalSockets ) != 0 ) return;
+
+        _notifier = new QSocketNotifier( signalSockets[1], QSocketNotifier::Read, this );
+        connect( _notifier, &QSocketNotifier::activated, this, &Profiler::signalReceived );
+
+        struct sigaction action = {};
+        action.sa_handler = signalHandler;
+        sigemptyset( &action.sa_mask );
+        action.sa_flags = SA_RESTART;
+        ::sigaction( SIGUSR1, &action, nullptr );
+
+        #endif
+
+    }
+
+    //________________________________________________
+    void Profiler::signalReceived( void )
+    {
+
+        #ifdef Q_OS_UNIX
+        char value;
+        const ssize_t count( ::read( signalSockets[1], &value, sizeof( value ) ) );
+        Q_UNUSED( count );
+        #endif
+
+        dump();
+
+    }
+
+    //________________________________________________
+    void Profiler::record( quint64 key, qint64 start, qint64 duration, qint64 missTime )
+    {
+        QMutexLocker locker( &_mutex );
+        _records[key].add( duration, missTime );
+
+        if( !_traceFile.isEmpty() && _events.size() < maxEvents )
+        { _events.append( { key, start, duration, quintptr( QThread::currentThreadId() ) } ); }
+    }
+
+    //________________________________________________
+    QString Profiler::name( quint64 key )
+    {
+
+        const Kind kind( Kind( key >> 32 ) );
+        const int element( int( quint32( key ) ) );
+
+        const char* out( nullptr );
+        switch( kind )
+        {
+            case Primitive: out = QMetaEnum::fromType<QStyle::PrimitiveElement>().valueToKey( element ); break;
+            case Control: out = QMetaEnum::fromType<QStyle::ControlElement>().valueToKey( element ); break;
+            case ComplexControl: out = QMetaEnum::fromType<QStyle::ComplexControl>().valueToKey( element ); break;
+            case Tile:
+            if( element >= 0 && element < int( sizeof( tileNames )/sizeof( tileNames[0] ) ) ) out = tileNames[element];
+            break;
+        }
+
+        // custom elements, registered at runtime by KStyle
+        if( out ) return QString::fromLatin1( out );
+        else return QStringLiteral( "%1 0x%2" ).arg( QLatin1String( category( kind ) ) ).arg( element, 0, 16 );
+
+    }
+
+    //________________________________________________
+    void Profiler::report( void )
+    {
+
+        QMutexLocker locker( &_mutex );
+
+        QVector<quint64> keys( _records.keys().toVector() );
+        std::sort( keys.begin(), keys.end(), [this]( quint64 first, quint64 second )
+            { return _records[first]._total > _records[second]._total; } );
+
+        // element times are inclusive: a control's time contains the primitives it draws
+        QTextStream out( stderr );
+        out << "Oxygen style profile, " << QCoreApplication::applicationName() << "\n";
+        out << "element\tcalls\ttotal ms\tmean us\tp99 us\tmax us\tcache miss ms\n";
+        for( const quint64 key:std::as_const( keys ) )
+        {
+            const Record& record( _records[key] );
+            out
+                << name( key ) << "\t"
+                << record._calls << "\t"
+                << record._total/1e6 << "\t"
+                << record._total/1e3/record._calls << "\t"
+                << record.percentile( 0.99 )/1e3 << "\t"
+                << record._max/1e3 << "\t"
+                << record._missTime/1e6 << "\n";
+        }
+
+    }
+
+    //________________________________________________
+    void Profiler::writeTrace( void )
+    {
+
+        if( _traceFile.isEmpty() ) return;
+
+        QMutexLocker locker( &_mutex );
+
+        QFile file( _traceFile );
+        if( !file.open( QIODevice::WriteOnly|QIODevice::Truncate ) )
+        {
+            QTextStream( stderr ) << "Oxygen style profile: cannot write to " << _traceFile << "\n";
+            return;
+        }
+
+        // chrome trace event format, complete events with timestamps in microseconds
+        QHash<quint64, QString> names;
+        const qint64 pid( QCoreApplication::applicationPid() );
+
+        QTextStream out( &file );
+        out << "{\"traceEvents\":[\n";
+        bool first( true );
+        for( const Event& event:std::as_const( _events ) )
+        {
+            auto iter( names.find( event._key ) );
+            if( iter == names.end() ) iter = names.insert( event._key, name( event._key ) );
+
+            if( !first ) out << ",\n";
+            first = false;
+
+            out
+                << "{\"name\":\"" << iter.value()
+                << "\",\"cat\":\"" << category( Kind( event._key >> 32 ) )
+                << "\",\"ph\":\"X\",\"ts\":" << QString::number( event._start/1e3, 'f', 3 )
+                << ",\"dur\":" << QString::number( event._duration/1e3, 'f', 3 )
+                << ",\"pid\":" << pid
+                << ",\"tid\":" << quint64( event._thread ) << "}";
+        }
+
+        out << "\n]}\n";
+
+    }
+
+}
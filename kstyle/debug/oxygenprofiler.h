@@ -0,0 +1,247 @@
+#ifndef oxygenprofiler_h
+#define oxygenprofiler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenprofiler.h
+// per element paint time profiler
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QPointer>
+#include <QStyle>
+#include <QVector>
+
+#include <atomic>
+
+class QSocketNotifier;
+
+namespace Oxygen
+{
+
+    //* per element paint time profiler
+    /**
+    enabled with OXYGEN_PROFILE=1, or the setProfilingEnabled DBus signal on /OxygenStyle.
+    The report is printed on exit, on SIGUSR1, or on the dumpProfile DBus signal.
+    Chrome trace events are also written when OXYGEN_PROFILE_TRACE names a file.
+    */
+    class Profiler: public QObject
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //* profiled element kind
+        enum Kind
+        {
+            Primitive,
+            Control,
+            ComplexControl,
+            Tile
+        };
+
+        //* tiles and pixmaps built by StyleHelper on cache misses
+        enum TileType
+        {
+            DockWidgetButton,
+            RoundCorner,
+            Slope,
+            Slab,
+            SlabSunken,
+            ProgressBarIndicator,
+            DialSlab,
+            RoundSlab,
+            SliderSlab,
+            HoleFlat,
+            ScrollHole,
+            ScrollHandle,
+            SlitFocused,
+            DockFrame,
+            Selection,
+            TabTear,
+            Hole
+        };
+
+        //* true when profiling
+        static bool enabled( void )
+        { return _enabled.load( std::memory_order_relaxed ); }
+
+        //* enable or disable profiling. Collected data is kept
+        static void setEnabled( bool );
+
+        //* enable from environment
+        static void initialize( void );
+
+        //* print report to standard error, and write trace file if any
+        static void dump( void );
+
+        //* measure time spent in a scope
+        /** costs a single branch when profiling is disabled */
+        class Scope
+        {
+            public:
+
+            //* constructor
+            explicit Scope( QStyle::PrimitiveElement element ):
+                Scope( Primitive, element )
+            {}
+
+            //* constructor
+            explicit Scope( QStyle::ControlElement element ):
+                Scope( Control, element )
+            {}
+
+            //* constructor
+            explicit Scope( QStyle::ComplexControl element ):
+                Scope( ComplexControl, element )
+            {}
+
+            //* constructor
+            explicit Scope( TileType element ):
+                Scope( Tile, element )
+            {}
+
+            //* destructor
+            ~Scope( void )
+            { if( Q_UNLIKELY( _start >= 0 ) ) stop(); }
+
+            private:
+
+            //* constructor
+            Scope( Kind kind, int element )
+            { if( Q_UNLIKELY( enabled() ) ) start( kind, element ); }
+
+            //* start measurement
+            void start( Kind, int );
+
+            //* stop measurement and record
+            void stop( void );
+
+            //* record key
+            quint64 _key = 0;
+
+            //* start time, negative when not measuring
+            qint64 _start = -1;
+
+            //* time spent building tiles, in nested scopes
+            qint64 _missTime = 0;
+
+            //* enclosing scope
+            Scope* _parent = nullptr;
+
+            Q_DISABLE_COPY( Scope )
+
+        };
+
+        private Q_SLOTS:
+
+        //* dump on signal
+        void signalReceived( void );
+
+        private:
+
+        //* constructor
+        explicit Profiler( QObject* );
+
+        //* singleton
+        static Profiler* instance( void );
+
+        //* install SIGUSR1 handler
+        void installSignalHandler( void );
+
+        //* record a measurement
+        void record( quint64 key, qint64 start, qint64 duration, qint64 missTime );
+
+        //* print report
+        void report( void );
+
+        //* write chrome trace
+        void writeTrace( void );
+
+        //* element name from key
+        static QString name( quint64 );
+
+        //* per element record
+        class Record
+        {
+            public:
+
+            //* number of calls
+            quint64 _calls = 0;
+
+            //* total time, in nanoseconds
+            qint64 _total = 0;
+
+            //* longest call
+            qint64 _max = 0;
+
+            //* time spent building tiles on cache misses
+            qint64 _missTime = 0;
+
+            //* log-linear histogram of call durations
+            QVector<quint32> _histogram;
+
+            //* add one call
+            void add( qint64, qint64 );
+
+            //* duration at given fraction of calls, in nanoseconds
+            qint64 percentile( qreal ) const;
+
+        };
+
+        //* trace event
+        class Event
+        {
+            public:
+
+            //* record key
+            quint64 _key;
+
+            //* start, in nanoseconds
+            qint64 _start;
+
+            //* duration, in nanoseconds
+            qint64 _duration;
+
+            //* thread
+            quintptr _thread;
+
+        };
+
+        //* enable state
+        static std::atomic<bool> _enabled;
+
+        //* singleton
+        static QPointer<Profiler> _instance;
+
+        //* clock
+        QElapsedTimer _timer;
+
+        //* protects records and events
+        QMutex _mutex;
+
+        //* records
+        QHash<quint64, Record> _records;
+
+        //* trace file
+        QString _traceFile;
+
+        //* trace events, only collected when a trace file is set
+        QVector<Event> _events;
+
+        //* signal notifier
+        QSocketNotifier* _notifier = nullptr;
+
+    };
+
+}
+
+#endif
@@ -13,14 +13,61 @@
 
 #include <QTextStream>
 #include <QApplication>
+#include <QHeaderView>
 #include <QMouseEvent>
+#include <QPaintEvent>
 #include <QPainter>
+#include <QTreeWidget>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace Oxygen
 {
 
+    namespace
+    {
+
+        //* heat half life, in milliseconds
+        const qreal heatHalfLife = 1000;
+
+        //* heat below which nothing is drawn
+        const qreal minHeat = 0.05;
+
+        //* heat at which color saturates
+        const qreal maxHeat = 8;
+
+        //* repaints closer than this form a sequence, in milliseconds
+        const qint64 sequenceInterval = 50;
+
+        //* a sequence longer than this is considered an animation, in milliseconds
+        const qint64 animationDuration = 200;
+
+        //* heat map fading interval, in milliseconds
+        const int fadeInterval = 250;
+
+        //* number of timer ticks between statistics view updates
+        const int statisticsViewTicks = 4;
+
+        //* number of widgets listed in statistics view
+        const int statisticsViewCount = 50;
+
+        //* statistics view columns
+        enum Column
+        {
+            ColumnWidget,
+            ColumnRepaints,
+            ColumnFullRepaints,
+            ColumnAnimatedFullRepaints,
+            ColumnTotalTime,
+            ColumnMeanTime,
+            ColumnMaxTime,
+            ColumnCount
+        };
+
+    }
+
     //________________________________________________
     WidgetExplorer::WidgetExplorer( QObject* parent ):
         QObject( parent ),
@@ -44,8 +91,14 @@ namespace Oxygen
 
         // _eventTypes.insert( QEvent::Paint, "Paint" );
 
+        _clock.start();
+
     }
 
+    //________________________________________________
+    WidgetExplorer::~WidgetExplorer( void )
+    { delete _statisticsView.data(); }
+
     //________________________________________________
     void WidgetExplorer::setEnabled( bool value )
     {
@@ -54,6 +107,62 @@ namespace Oxygen
 
         qApp->removeEventFilter( this );
         if( _enabled )  qApp->installEventFilter( this );
+
+        setupHeatMap();
+    }
+
+    //________________________________________________
+    void WidgetExplorer::setDrawRepaintHeatMap( bool value )
+    {
+        if( value == _drawRepaintHeatMap ) return;
+        _drawRepaintHeatMap = value;
+        setupHeatMap();
+    }
+
+    //________________________________________________
+    void WidgetExplorer::setupHeatMap( void )
+    {
+
+        if( _enabled && _drawRepaintHeatMap )
+        {
+
+            if( _statisticsView ) return;
+
+            // sortable list of the most expensive widgets
+            _statisticsView = new QTreeWidget();
+            _statisticsView->setAttribute( Qt::WA_DeleteOnClose );
+            _statisticsView->setWindowTitle( QStringLiteral( "Oxygen Repaint Statistics" ) );
+            _statisticsView->setRootIsDecorated( false );
+            _statisticsView->setColumnCount( ColumnCount );
+            _statisticsView->setHeaderLabels( {
+                QStringLiteral( "Widget" ),
+                QStringLiteral( "Repaints" ),
+                QStringLiteral( "Full repaints" ),
+                QStringLiteral( "Animated full repaints" ),
+                QStringLiteral( "Total (ms)" ),
+                QStringLiteral( "Mean (ms)" ),
+                QStringLiteral( "Max (ms)" ) } );
+            _statisticsView->setSortingEnabled( true );
+            _statisticsView->sortByColumn( ColumnTotalTime, Qt::DescendingOrder );
+            _statisticsView->resize( 720, 400 );
+            _statisticsView->show();
+
+        } else {
+
+            // remove overlays
+            for( auto iter = _paintStatistics.constBegin(); iter != _paintStatistics.constEnd(); ++iter )
+            {
+                if( iter.value()._heat < minHeat ) continue;
+                const_cast<QWidget*>( static_cast<const QWidget*>( iter.key() ) )->update();
+            }
+
+            _paintStatistics.clear();
+            _fadingWindows.clear();
+            _timer.stop();
+            delete _statisticsView.data();
+
+        }
+
     }
 
     //________________________________________________
@@ -62,7 +171,7 @@ namespace Oxygen
 
         if( object->isWidgetType() )
         {
-            QString type( _eventTypes[event->type()] );
+            const QString type( _eventTypes.value( event->type() ) );
             if( !type.isEmpty() )
             {
                 std::cout << "Oxygen::WidgetExplorer::eventFilter - widget: " << object << " (" << qPrintable(object->metaObject()->className()) << ")";
@@ -85,6 +194,26 @@ namespace Oxygen
                 painter.drawRect( widget->rect() );
                 painter.end();
             }
+
+            if( _drawRepaintHeatMap && !_paintedWidgets.contains( object ) )
+            {
+                QWidget* widget( qobject_cast<QWidget*>( object ) );
+                if( !widget || widget->window() == _statisticsView.data() ) break;
+
+                paint( widget, static_cast<QPaintEvent*>( event ) );
+                return true;
+            }
+            break;
+
+            case QEvent::UpdateRequest:
+            if( !_fading && _fadingWindows.remove( object ) )
+            {
+                // repaints caused by fading are not counted
+                _fading = true;
+                QCoreApplication::sendEvent( object, event );
+                _fading = false;
+                return true;
+            }
             break;
 
             case QEvent::MouseButtonPress:
@@ -125,6 +254,197 @@ namespace Oxygen
 
     }
 
+    //________________________________________________
+    void WidgetExplorer::timerEvent( QTimerEvent* event )
+    {
+
+        if( event->timerId() != _timer.timerId() )
+        { return QObject::timerEvent( event ); }
+
+        // fade heat map
+        const qint64 now( _clock.elapsed() );
+        bool active( false );
+        for( auto iter = _paintStatistics.begin(); iter != _paintStatistics.end(); ++iter )
+        {
+            PaintStatistics& statistics( iter.value() );
+            if( statistics._heat <= 0 ) continue;
+
+            updateHeat( statistics, now );
+            if( statistics._heat < minHeat ) statistics._heat = 0;
+            else active = true;
+
+            QWidget* widget( const_cast<QWidget*>( static_cast<const QWidget*>( iter.key() ) ) );
+            _fadingWindows.insert( widget->window() );
+            widget->update();
+        }
+
+        if( ++_ticks%statisticsViewTicks == 0 ) updateStatisticsView();
+        if( !active ) _timer.stop();
+
+    }
+
+    //________________________________________________
+    void WidgetExplorer::widgetDestroyed( QObject* object )
+    {
+        _paintStatistics.remove( object );
+        _fadingWindows.remove( object );
+    }
+
+    //________________________________________________
+    void WidgetExplorer::paint( QWidget* widget, QPaintEvent* event )
+    {
+
+        // send the event again, this time reaching the widget, and measure
+        QPointer<QWidget> guard( widget );
+        _paintedWidgets.insert( widget );
+        QElapsedTimer timer;
+        timer.start();
+        QCoreApplication::sendEvent( widget, event );
+        const qint64 duration( timer.nsecsElapsed() );
+        _paintedWidgets.remove( widget );
+        if( !guard ) return;
+
+        auto iter( _paintStatistics.find( widget ) );
+        if( iter == _paintStatistics.end() )
+        {
+            iter = _paintStatistics.insert( widget, PaintStatistics() );
+            iter->_className = QString::fromLatin1( widget->metaObject()->className() );
+            iter->_objectName = widget->objectName();
+            connect( widget, &QObject::destroyed, this, &WidgetExplorer::widgetDestroyed, Qt::UniqueConnection );
+        }
+
+        PaintStatistics& statistics( iter.value() );
+        if( !_fading )
+        {
+
+            const qint64 now( _clock.elapsed() );
+
+            ++statistics._repaints;
+            statistics._totalTime += duration;
+            statistics._maxTime = qMax( statistics._maxTime, duration );
+
+            // closely spaced repaints that last long enough are assumed to come from an animation
+            if( statistics._lastRepaint < 0 || now - statistics._lastRepaint > sequenceInterval ) statistics._sequenceStart = now;
+            statistics._lastRepaint = now;
+
+            if( QRegion( widget->rect() ).subtracted( event->region() ).isEmpty() )
+            {
+                ++statistics._fullRepaints;
+                if( now - statistics._sequenceStart >= animationDuration ) ++statistics._animatedFullRepaints;
+            }
+
+            updateHeat( statistics, now );
+            statistics._heat += 1;
+
+            if( !_timer.isActive() ) _timer.start( fadeInterval, this );
+
+        }
+
+        drawHeatMap( widget, event, statistics );
+
+    }
+
+    //________________________________________________
+    void WidgetExplorer::drawHeatMap( QWidget* widget, QPaintEvent* event, const PaintStatistics& statistics ) const
+    {
+
+        if( statistics._heat < minHeat ) return;
+
+        QPainter painter( widget );
+        painter.setClipRegion( event->region() );
+
+        // from yellow to red, as heat increases
+        const qreal ratio( qMin<qreal>( 1.0, statistics._heat/maxHeat ) );
+        QColor color( QColor::fromHsvF( ( 1.0 - ratio )/6, 1.0, 1.0 ) );
+        color.setAlphaF( 0.1 + 0.4*ratio );
+        painter.fillRect( widget->rect(), color );
+
+        // full repaints while animating
+        if( statistics._animatedFullRepaints > 0 )
+        {
+            painter.setPen( QPen( Qt::magenta, 2 ) );
+            painter.setBrush( Qt::NoBrush );
+            painter.drawRect( widget->rect().adjusted( 1, 1, -1, -1 ) );
+        }
+
+        // paint cost
+        if( widget->width() < 48 || widget->height() < 12 ) return;
+
+        QFont font( widget->font() );
+        font.setPointSizeF( qMax<qreal>( 6, 0.8*font.pointSizeF() ) );
+        painter.setFont( font );
+        painter.setPen( Qt::black );
+        painter.drawText( widget->rect().adjusted( 2, 1, -2, -1 ), Qt::AlignLeft|Qt::AlignTop,
+            QStringLiteral( "%1x %2ms" ).arg( statistics._repaints ).arg( statistics._totalTime/1e6/qMax( 1, statistics._repaints ), 0, 'f', 2 ) );
+
+    }
+
+    //________________________________________________
+    void WidgetExplorer::updateHeat( PaintStatistics& statistics, qint64 now )
+    {
+        statistics._heat *= std::pow( 0.5, ( now - statistics._heatTime )/heatHalfLife );
+        statistics._heatTime = now;
+    }
+
+    //________________________________________________
+    void WidgetExplorer::updateStatisticsView( void )
+    {
+
+        if( !_statisticsView ) return;
+
+        // numerical value of a given column
+        const auto value = []( const PaintStatistics& statistics, int column ) -> qreal
+        {
+            switch( column )
+            {
+                case ColumnRepaints: return statistics._repaints;
+                case ColumnFullRepaints: return statistics._fullRepaints;
+                case ColumnAnimatedFullRepaints: return statistics._animatedFullRepaints;
+                case ColumnMeanTime: return statistics._repaints ? qreal( statistics._totalTime )/statistics._repaints : 0;
+                case ColumnMaxTime: return statistics._maxTime;
+                case ColumnTotalTime: default: return statistics._totalTime;
+            }
+        };
+
+        // keep the widgets that come first in the current sort order
+        const int column( _statisticsView->header()->sortIndicatorSection() );
+        const bool descending( _statisticsView->header()->sortIndicatorOrder() == Qt::DescendingOrder );
+
+        QVector<const PaintStatistics*> sorted;
+        sorted.reserve( _paintStatistics.size() );
+        for( const PaintStatistics& statistics:std::as_const( _paintStatistics ) )
+        { if( statistics._repaints ) sorted.append( &statistics ); }
+
+        const int count( qMin( statisticsViewCount, sorted.size() ) );
+        std::partial_sort( sorted.begin(), sorted.begin() + count, sorted.end(),
+            [&value, column, descending]( const PaintStatistics* first, const PaintStatistics* second )
+            {
+                const qreal firstValue( value( *first, column ) );
+                const qreal secondValue( value( *second, column ) );
+                return descending ? firstValue > secondValue : firstValue < secondValue;
+            } );
+
+        _statisticsView->setUpdatesEnabled( false );
+        _statisticsView->clear();
+        for( int i = 0; i < count; ++i )
+        {
+            const PaintStatistics& statistics( *sorted[i] );
+            auto item( new QTreeWidgetItem( _statisticsView ) );
+            item->setText( ColumnWidget, statistics._objectName.isEmpty() ?
+                statistics._className :
+                QStringLiteral( "%1 (%2)" ).arg( statistics._className, statistics._objectName ) );
+            item->setData( ColumnRepaints, Qt::DisplayRole, statistics._repaints );
+            item->setData( ColumnFullRepaints, Qt::DisplayRole, statistics._fullRepaints );
+            item->setData( ColumnAnimatedFullRepaints, Qt::DisplayRole, statistics._animatedFullRepaints );
+            item->setData( ColumnTotalTime, Qt::DisplayRole, statistics._totalTime/1e6 );
+            item->setData( ColumnMeanTime, Qt::DisplayRole, value( statistics, ColumnMeanTime )/1e6 );
+            item->setData( ColumnMaxTime, Qt::DisplayRole, statistics._maxTime/1e6 );
+        }
+
+        _statisticsView->setUpdatesEnabled( true );
+
+    }
+
     //________________________________________________
     QString WidgetExplorer::eventType( const QEvent::Type& type ) const
     {
@@ -11,16 +11,27 @@
 // SPDX-License-Identifier: MIT
 //////////////////////////////////////////////////////////////////////////////
 
+#include <QBasicTimer>
+#include <QElapsedTimer>
 #include <QEvent>
+#include <QHash>
 #include <QObject>
 #include <QMap>
+#include <QPointer>
 #include <QSet>
 #include <QWidget>
 
+class QPaintEvent;
+class QTreeWidget;
+
 namespace Oxygen
 {
 
     //* print widget's and parent's information on mouse click
+    /**
+    optionally records per-widget repaints and paint times, draws them as a fading heat map,
+    and lists the most expensive widgets in a separate, sortable window
+    */
     class WidgetExplorer: public QObject
     {
 
@@ -31,6 +42,9 @@ namespace Oxygen
         //* constructor
         explicit WidgetExplorer( QObject* );
 
+        //* destructor
+        ~WidgetExplorer( void ) override;
+
         //* enable
         bool enabled( void ) const;
 
@@ -41,11 +55,79 @@ namespace Oxygen
         void setDrawWidgetRects( bool value )
         { _drawWidgetRects = value; }
 
+        //* repaint heat map and statistics
+        void setDrawRepaintHeatMap( bool );
+
         //* event filter
         bool eventFilter( QObject*, QEvent* ) override;
 
+        protected:
+
+        //* timer event
+        void timerEvent( QTimerEvent* ) override;
+
+        private Q_SLOTS:
+
+        //* remove statistics of destroyed widgets
+        void widgetDestroyed( QObject* );
+
         private:
 
+        //* per widget repaint statistics
+        class PaintStatistics
+        {
+            public:
+
+            //* class name
+            QString _className;
+
+            //* object name
+            QString _objectName;
+
+            //* number of counted repaints
+            int _repaints = 0;
+
+            //* repaints covering the whole widget
+            int _fullRepaints = 0;
+
+            //* repaints covering the whole widget while animating
+            int _animatedFullRepaints = 0;
+
+            //* total paint time, in nanoseconds
+            qint64 _totalTime = 0;
+
+            //* longest paint time, in nanoseconds
+            qint64 _maxTime = 0;
+
+            //* decaying repaint count, used for the heat map
+            qreal _heat = 0;
+
+            //* time of last heat update, in milliseconds
+            qint64 _heatTime = 0;
+
+            //* time of last counted repaint, in milliseconds
+            qint64 _lastRepaint = -1;
+
+            //* start of the current sequence of closely spaced repaints, in milliseconds
+            qint64 _sequenceStart = -1;
+
+        };
+
+        //* create or delete statistics view and timer, matching enable state
+        void setupHeatMap( void );
+
+        //* paint widget, measuring time, and record statistics
+        void paint( QWidget*, QPaintEvent* );
+
+        //* draw heat map and paint cost over widget
+        void drawHeatMap( QWidget*, QPaintEvent*, const PaintStatistics& ) const;
+
+        //* decay heat to given time
+        static void updateHeat( PaintStatistics&, qint64 );
+
+        //* update statistics view
+        void updateStatisticsView( void );
+
         //* event type
         QString eventType( const QEvent::Type& ) const;
 
@@ -58,9 +140,36 @@ namespace Oxygen
         //* widget rects
         bool _drawWidgetRects = false;
 
+        //* heat map
+        bool _drawRepaintHeatMap = false;
+
         //* map event types to string
         QMap<QEvent::Type, QString > _eventTypes;
 
+        //* repaint statistics
+        QHash<const QObject*, PaintStatistics> _paintStatistics;
+
+        //* widgets being painted, to avoid measuring twice when the paint event is sent again
+        QSet<const QObject*> _paintedWidgets;
+
+        //* windows updated to fade the heat map. Repaints in their next update request are not counted
+        QSet<const QObject*> _fadingWindows;
+
+        //* true while processing an update request triggered by fading
+        bool _fading = false;
+
+        //* clock, for heat and animation detection
+        QElapsedTimer _clock;
+
+        //* heat map fading timer
+        QBasicTimer _timer;
+
+        //* number of timer ticks, used to refresh statistics view less often
+        int _ticks = 0;
+
+        //* statistics view
+        QPointer<QTreeWidget> _statisticsView;
+
     };
 
 }
@@ -9,6 +9,10 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygendemodialog.h"
+#include "oxygenframebenchmark.h"
+#include "oxygenheadlessbenchmark.h"
+#include "oxygeninputtrace.h"
+#include "oxygenlayoutbenchmark.h"
 #include "../oxygen.h"
 #include "config-liboxygen.h"
 
@@ -16,6 +20,7 @@
 #include <QCommandLineOption>
 #include <QCommandLineParser>
 #include <QIcon>
+#include <QTextStream>
 
 #include <KLocalizedString>
 
@@ -24,19 +29,109 @@ namespace Oxygen
 
     int run(int argc, char *argv[])
     {
-        QApplication app( argc, argv );
+
+        // unattended benchmarks default to the offscreen platform.
+        // This must be decided before the application is created
+        for( int i = 1; i < argc; ++i )
+        {
+            if( qstrncmp( argv[i], "--headless-benchmark", 20 ) ) continue;
+            if( !qEnvironmentVariableIsSet( "QT_QPA_PLATFORM" ) ) qputenv( "QT_QPA_PLATFORM", "offscreen" );
+            break;
+        }
+
+        BenchmarkApplication app( argc, argv );
 
         QCommandLineParser commandLine;
         QCommandLineOption enableHighDpi( "highdpi", "Enable High DPI pixmaps" );
         commandLine.addOption( enableHighDpi );
+        QCommandLineOption layoutBenchmark( "layout-benchmark", "Measure relayout of a 2000 widgets form and exit", "iterations", "50" );
+        commandLine.addOption( layoutBenchmark );
+        QCommandLineOption frameBenchmark( "frame-benchmark", "Measure widget count and repaint of 200 scroll areas and 40 flat frames and exit", "iterations", "50" );
+        commandLine.addOption( frameBenchmark );
+        QCommandLineOption headlessBenchmark( "headless-benchmark", "Run demo pages benchmarks unattended, write timings and style memory footprint as JSON to file, or standard output for '-', and exit", "file" );
+        commandLine.addOption( headlessBenchmark );
+        QCommandLineOption benchmarkPages( "pages", "Comma separated pages to run with --headless-benchmark: button, frame, input, list, mdi, memory, slider, tab, and stress pages formstress, mdistress, menustress, scrollareastress, tabstress, toolbarstress, treestress", "pages" );
+        commandLine.addOption( benchmarkPages );
+        QCommandLineOption benchmarkRepeat( "repeat", "Number of runs per page with --headless-benchmark", "count", "1" );
+        commandLine.addOption( benchmarkRepeat );
+        QCommandLineOption benchmarkDelay( "delay", "Fixed delay between simulated events with --headless-benchmark, in milliseconds", "delay", "0" );
+        commandLine.addOption( benchmarkDelay );
+        QCommandLineOption recordInput( "record", "Record input events to file, until the demo exits", "file" );
+        commandLine.addOption( recordInput );
+        QCommandLineOption replayInput( "replay", "Replay input events recorded with --record, and exit", "file" );
+        commandLine.addOption( replayInput );
+        QCommandLineOption replaySpeed( "speed", "Speed factor for --replay. 0 replays as fast as events can be processed", "factor", "1" );
+        commandLine.addOption( replaySpeed );
+        QCommandLineOption replayReport( "replay-report", "Write --replay frame timings as JSON to file, or standard output for '-'", "file", "-" );
+        commandLine.addOption( replayReport );
         commandLine.process( app );
 
         app.setAttribute( Qt::AA_UseHighDpiPixmaps, commandLine.isSet( enableHighDpi ) );
 
+        if( commandLine.isSet( layoutBenchmark ) )
+        {
+            LayoutBenchmark benchmark;
+            benchmark.run( commandLine.value( layoutBenchmark ).toInt() );
+            return 0;
+        }
+
+        if( commandLine.isSet( frameBenchmark ) )
+        {
+            FrameBenchmark benchmark;
+            benchmark.run( commandLine.value( frameBenchmark ).toInt() );
+            return 0;
+        }
+
         app.setApplicationName( i18n( "Oxygen Demo" ) );
         app.setWindowIcon( QIcon::fromTheme( QStringLiteral( "oxygen" ) ) );
         DemoDialog dialog;
+
+        if( commandLine.isSet( headlessBenchmark ) )
+        {
+            HeadlessBenchmark benchmark( app, dialog );
+            if( commandLine.isSet( benchmarkPages ) ) benchmark.setPages( commandLine.value( benchmarkPages ).split( QLatin1Char( ',' ), Qt::SkipEmptyParts ) );
+            benchmark.setRepeat( commandLine.value( benchmarkRepeat ).toInt() );
+            benchmark.setDelay( commandLine.value( benchmarkDelay ).toInt() );
+            return benchmark.run( commandLine.value( headlessBenchmark ) ) ? 0:1;
+        }
+
+        if( commandLine.isSet( replayInput ) )
+        {
+            InputTrace trace;
+            if( !trace.load( commandLine.value( replayInput ) ) )
+            {
+                QTextStream( stderr ) << "cannot read input trace " << commandLine.value( replayInput ) << "\n";
+                return 1;
+            }
+
+            dialog.show();
+            app.processEvents();
+
+            InputReplay replay( app, trace );
+            replay.setSpeed( commandLine.value( replaySpeed ).toDouble() );
+            QObject::connect( &replay, &InputReplay::finished, &app, &QApplication::quit );
+            replay.start();
+            app.exec();
+
+            return HeadlessBenchmark::write( replay.results(), commandLine.value( replayReport ) ) ? 0:1;
+        }
+
         dialog.show();
+
+        InputRecorder recorder( &app );
+        if( commandLine.isSet( recordInput ) )
+        {
+            const QString fileName( commandLine.value( recordInput ) );
+            app.processEvents();
+            recorder.start();
+            QObject::connect( &app, &QApplication::aboutToQuit, &recorder, [&recorder, fileName]()
+            {
+                recorder.stop();
+                if( !recorder.trace().save( fileName ) )
+                { QTextStream( stderr ) << "cannot write input trace " << fileName << "\n"; }
+            } );
+        }
+
         bool result = app.exec();
         return result;
     }
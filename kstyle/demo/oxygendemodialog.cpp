@@ -15,7 +15,9 @@
 #include "oxygenframedemowidget.h"
 #include "oxygenlistdemowidget.h"
 #include "oxygenmdidemowidget.h"
+#include "oxygenmemorydemowidget.h"
 #include "oxygensliderdemowidget.h"
+#include "oxygenstressdemowidget.h"
 #include "oxygentabdemowidget.h"
 #include "config-liboxygen.h"
 #ifdef HAVE_SCHEME_CHOOSER
@@ -152,6 +154,68 @@ namespace Oxygen
             items.append( page );
         }
 
+        // stress pages, modeling large applications
+        {
+            page = new KPageWidgetItem( new TreeStressDemoWidget() );
+            page->setName( i18n( "Large Views" ) );
+            setPageIcon( page, QStringLiteral( "view-list-details" ) );
+            page->setHeader( i18n( "Stress test with a 100000 rows tree and table" ) );
+            addPage( page );
+            items.append( page );
+
+            page = new KPageWidgetItem( new TabStressDemoWidget() );
+            page->setName( i18n( "Many Tabs" ) );
+            setPageIcon( page, QStringLiteral( "tab-new" ) );
+            page->setHeader( i18n( "Stress test with a 300 tabs tab bar" ) );
+            addPage( page );
+            items.append( page );
+
+            page = new KPageWidgetItem( new FormStressDemoWidget() );
+            page->setName( i18n( "Large Form" ) );
+            setPageIcon( page, QStringLiteral( "document-edit" ) );
+            page->setHeader( i18n( "Stress test with a 2000 widgets form" ) );
+            addPage( page );
+            items.append( page );
+
+            page = new KPageWidgetItem( new ScrollAreaStressDemoWidget() );
+            page->setName( i18n( "Nested Scroll Areas" ) );
+            setPageIcon( page, QStringLiteral( "zoom-fit-best" ) );
+            page->setHeader( i18n( "Stress test with 100 nested scroll areas" ) );
+            addPage( page );
+            items.append( page );
+
+            page = new KPageWidgetItem( new MdiStressDemoWidget() );
+            page->setName( i18n( "Many MDI Windows" ) );
+            setPageIcon( page, QStringLiteral( "window-duplicate" ) );
+            page->setHeader( i18n( "Stress test with 50 MDI windows" ) );
+            addPage( page );
+            items.append( page );
+
+            page = new KPageWidgetItem( new ToolBarStressDemoWidget() );
+            page->setName( i18n( "Large Toolbar" ) );
+            setPageIcon( page, QStringLiteral( "configure-toolbars" ) );
+            page->setHeader( i18n( "Stress test with a 200 buttons toolbar" ) );
+            addPage( page );
+            items.append( page );
+
+            page = new KPageWidgetItem( new MenuStressDemoWidget() );
+            page->setName( i18n( "Large Menu" ) );
+            setPageIcon( page, QStringLiteral( "application-menu" ) );
+            page->setHeader( i18n( "Stress test with a 500 items menu" ) );
+            addPage( page );
+            items.append( page );
+        }
+
+        // memory
+        {
+            page = new KPageWidgetItem( new MemoryDemoWidget() );
+            page->setName( i18n( "Memory" ) );
+            setPageIcon( page, QStringLiteral( "memory" ) );
+            page->setHeader( i18n( "Shows memory held by the style caches, animations and helper widgets" ) );
+            addPage( page );
+            items.append( page );
+        }
+
         // benchmark
         {
             auto benchmarkWidget( new BenchmarkWidget() );
@@ -173,6 +237,8 @@ namespace Oxygen
             connect( this, SIGNAL(abortSimulations()), &static_cast<DemoWidget*>(item->widget())->simulator(), SLOT(abort()) );
         }
 
+        _pages = items;
+
     }
 
     //_______________________________________________________________
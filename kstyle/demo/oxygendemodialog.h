@@ -16,6 +16,7 @@
 #include <KPageDialog>
 
 #include <QList>
+#include <QVector>
 #include <QWidget>
 #include <QCheckBox>
 
@@ -38,6 +39,10 @@ namespace Oxygen
         //* constructor
         explicit DemoDialog( QWidget* parent = nullptr );
 
+        //* pages
+        const QVector<KPageWidgetItem*>& pages( void ) const
+        { return _pages; }
+
         Q_SIGNALS:
 
         //* emitted when dialog is closed
@@ -73,6 +78,9 @@ namespace Oxygen
         //* reverse layout checkbox
         QCheckBox* _rightToLeftCheckBox = nullptr;
 
+        //* pages
+        QVector<KPageWidgetItem*> _pages;
+
     };
 
 }
@@ -0,0 +1,145 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenframebenchmark.cpp
+// measure widget count and repaint time of many sunken scroll areas and flat frames
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenframebenchmark.h"
+
+#include <QAbstractItemView>
+#include <QApplication>
+#include <QComboBox>
+#include <QElapsedTimer>
+#include <QGridLayout>
+#include <QListWidget>
+#include <QTextEdit>
+#include <QTextStream>
+
+#include <algorithm>
+
+namespace Oxygen
+{
+
+    //_______________________________________________
+    FrameBenchmark::FrameBenchmark( int scrollAreaCount, int flatFrameCount ):
+        _window( new QWidget() )
+    {
+
+        QGridLayout* layout( new QGridLayout( _window.data() ) );
+        const int columns( 20 );
+        for( int i = 0; i < scrollAreaCount; ++i )
+        {
+
+            QAbstractScrollArea* scrollArea( nullptr );
+            if( i%2 )
+            {
+
+                QListWidget* listWidget( new QListWidget() );
+                listWidget->addItems( { QStringLiteral( "First item" ), QStringLiteral( "Second item" ) } );
+                scrollArea = listWidget;
+
+            } else scrollArea = new QTextEdit( QStringLiteral( "Text %1" ).arg( i ) );
+
+            scrollArea->setMinimumSize( 60, 40 );
+            layout->addWidget( scrollArea, i/columns, i%columns );
+            _scrollAreas.append( scrollArea );
+
+        }
+
+        // flat frame shadows are only installed on views whose parent is a combobox popup container.
+        // The container is moved into the window, so that all views are shown and painted together.
+        // Comboboxes stay hidden, and are created first so that they are deleted before their containers
+        const int rows( ( scrollAreaCount + columns - 1 )/columns );
+        for( int i = 0; i < flatFrameCount; ++i )
+        {
+
+            QComboBox* comboBox( new QComboBox( _window.data() ) );
+            comboBox->hide();
+            comboBox->addItems( { QStringLiteral( "First item" ), QStringLiteral( "Second item" ) } );
+
+            QAbstractScrollArea* view( comboBox->view() );
+            QWidget* container( view->parentWidget() );
+            container->setParent( _window.data(), Qt::Widget );
+            container->setMinimumSize( 60, 40 );
+            layout->addWidget( container, rows + i/columns, i%columns );
+            container->show();
+            _flatFrames.append( view );
+
+        }
+
+    }
+
+    //_______________________________________________
+    void FrameBenchmark::run( int iterations )
+    {
+
+        QTextStream out( stdout );
+
+        _window->show();
+        qApp->processEvents();
+
+        // repeated repaints of every scroll area, frame and viewport included
+        QVector<qint64> samples;
+        samples.reserve( iterations );
+        QElapsedTimer timer;
+        for( int i = 0; i < iterations; ++i )
+        {
+            timer.start();
+            for( QAbstractScrollArea* scrollArea:std::as_const( _scrollAreas ) )
+            { scrollArea->repaint(); }
+            samples.append( timer.nsecsElapsed() );
+        }
+
+        QVector<qint64> flatSamples;
+        flatSamples.reserve( iterations );
+        for( int i = 0; i < iterations && !_flatFrames.isEmpty(); ++i )
+        {
+            timer.start();
+            for( QAbstractScrollArea* view:std::as_const( _flatFrames ) )
+            { view->repaint(); }
+            flatSamples.append( timer.nsecsElapsed() );
+        }
+
+        // frame shadows are counted by class name, which is identical before and after
+        // the switch to a single overlay per frame, so that both trees can be compared
+        const auto widgets( _window->findChildren<QWidget*>() );
+        const int shadows( std::count_if( widgets.begin(), widgets.end(),
+            []( const QWidget* widget ) { return widget->inherits( "Oxygen::SunkenFrameShadow" ); } ) );
+        const int flatShadows( std::count_if( widgets.begin(), widgets.end(),
+            []( const QWidget* widget ) { return widget->inherits( "Oxygen::FlatFrameShadow" ); } ) );
+
+        out
+            << "scroll areas: " << _scrollAreas.size() << "\n"
+            << "flat frames: " << _flatFrames.size() << "\n"
+            << "widgets: " << widgets.size() << "\n"
+            << "sunken frame shadow widgets: " << shadows << "\n"
+            << "flat frame shadow widgets: " << flatShadows << "\n";
+
+        print( out, QStringLiteral( "repaint" ), samples );
+        print( out, QStringLiteral( "flat repaint" ), flatSamples );
+
+    }
+
+    //_______________________________________________
+    void FrameBenchmark::print( QTextStream& out, const QString& name, QVector<qint64> samples )
+    {
+
+        if( samples.isEmpty() ) return;
+
+        std::sort( samples.begin(), samples.end() );
+        qint64 total( 0 );
+        for( const qint64 sample:samples ) total += sample;
+
+        out
+            << name << "s: " << samples.size() << "\n"
+            << name << " min: " << samples.first()/1000 << " us" << "\n"
+            << name << " median: " << samples[samples.size()/2]/1000 << " us" << "\n"
+            << name << " mean: " << total/samples.size()/1000 << " us" << "\n";
+
+    }
+
+}
@@ -0,0 +1,54 @@
+#ifndef oxygenframebenchmark_h
+#define oxygenframebenchmark_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenframebenchmark.h
+// measure widget count and repaint time of many sunken scroll areas and flat frames
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QAbstractScrollArea>
+#include <QScopedPointer>
+#include <QTextStream>
+#include <QVector>
+#include <QWidget>
+
+namespace Oxygen
+{
+
+    //! repaint a window holding many scroll areas and report timings
+    class FrameBenchmark
+    {
+
+        public:
+
+        //! constructor
+        /** flat frames are the item views of combobox popups, embedded in the window */
+        explicit FrameBenchmark( int scrollAreaCount = 200, int flatFrameCount = 40 );
+
+        //! run given number of repaints and print timings to standard output
+        void run( int iterations );
+
+        private:
+
+        //! print statistics of given samples, in nanoseconds
+        static void print( QTextStream&, const QString&, QVector<qint64> );
+
+        //! window
+        QScopedPointer<QWidget> _window;
+
+        //! sunken scroll areas
+        QVector<QAbstractScrollArea*> _scrollAreas;
+
+        //! flat frames
+        QVector<QAbstractScrollArea*> _flatFrames;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,207 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenheadlessbenchmark.cpp
+// run demo pages benchmarks unattended, and write timings as JSON
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenheadlessbenchmark.h"
+#include "oxygendemodialog.h"
+#include "oxygenmemorydemowidget.h"
+#include "oxygensimulator.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QStyle>
+#include <QTextStream>
+
+#include <KPageWidgetModel>
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //* value at given fraction of sorted samples, in microseconds
+        double percentile( const QVector<qint64>& samples, qreal fraction )
+        {
+            if( samples.isEmpty() ) return 0;
+            const int index( qBound( 0, int( std::ceil( fraction*samples.size() ) ) - 1, samples.size() - 1 ) );
+            return samples[index]/1000.0;
+        }
+
+        //* process cpu time, in milliseconds
+        double cpuTime( void )
+        { return 1000.0*std::clock()/CLOCKS_PER_SEC; }
+
+    }
+
+    //_______________________________________________
+    bool BenchmarkApplication::notify( QObject* receiver, QEvent* event )
+    {
+
+        QVector<qint64>* samples( nullptr );
+        if( _paintSamples && event->type() == QEvent::Paint ) samples = _paintSamples;
+        else if( _frameSamples && event->type() == QEvent::UpdateRequest && receiver->isWidgetType() && static_cast<QWidget*>( receiver )->isWindow() ) samples = _frameSamples;
+
+        if( !samples ) return QApplication::notify( receiver, event );
+
+        QElapsedTimer timer;
+        timer.start();
+        const bool result( QApplication::notify( receiver, event ) );
+        samples->append( timer.nsecsElapsed() );
+        return result;
+
+    }
+
+    //_______________________________________________
+    HeadlessBenchmark::HeadlessBenchmark( BenchmarkApplication& application, DemoDialog& dialog ):
+        _application( application ),
+        _dialog( dialog )
+    {}
+
+    //_______________________________________________
+    QString HeadlessBenchmark::key( const QWidget* widget )
+    {
+
+        // Oxygen::ButtonDemoWidget gives button
+        QString out( QString::fromLatin1( widget->metaObject()->className() ) );
+        out = out.mid( out.lastIndexOf( QLatin1Char( ':' ) ) + 1 );
+        if( out.endsWith( QLatin1String( "DemoWidget" ) ) ) out.chop( 10 );
+        return out.toLower();
+
+    }
+
+    //_______________________________________________
+    bool HeadlessBenchmark::run( const QString& fileName )
+    {
+
+        Simulator::setGrabMouse( false );
+        Simulator::setFixedDelay( _delay );
+
+        _dialog.show();
+        _application.processEvents();
+
+        QJsonArray pages;
+        for( KPageWidgetItem* item:_dialog.pages() )
+        {
+
+            QWidget* widget( item->widget() );
+            if( widget->metaObject()->indexOfSlot( "benchmark()" ) < 0 ) continue;
+            if( !( _pages.isEmpty() || _pages.contains( key( widget ), Qt::CaseInsensitive ) ) ) continue;
+
+            pages.append( run( item ) );
+
+        }
+
+        QJsonObject results;
+        results.insert( QStringLiteral( "platform" ), QGuiApplication::platformName() );
+        results.insert( QStringLiteral( "style" ), _application.style()->objectName() );
+        results.insert( QStringLiteral( "qtVersion" ), QString::fromLatin1( qVersion() ) );
+        results.insert( QStringLiteral( "delay" ), _delay );
+        results.insert( QStringLiteral( "repeat" ), _repeat );
+        results.insert( QStringLiteral( "pages" ), pages );
+
+        // memory held by the style once all pages have run
+        const QVariantList memory( MemoryDemoWidget::footprint( _application.style() ) );
+        if( !memory.isEmpty() ) results.insert( QStringLiteral( "memory" ), QJsonArray::fromVariantList( memory ) );
+
+        return write( results, fileName );
+
+    }
+
+    //_______________________________________________
+    bool HeadlessBenchmark::write( const QJsonObject& object, const QString& fileName )
+    {
+
+        const QByteArray json( QJsonDocument( object ).toJson() );
+        if( fileName.isEmpty() || fileName == QLatin1String( "-" ) )
+        {
+
+            QTextStream( stdout ) << json;
+            return true;
+
+        }
+
+        QFile file( fileName );
+        if( !file.open( QIODevice::WriteOnly|QIODevice::Truncate ) )
+        {
+            QTextStream( stderr ) << "cannot write to " << fileName << "\n";
+            return false;
+        }
+
+        file.write( json );
+        return true;
+
+    }
+
+    //_______________________________________________
+    QJsonObject HeadlessBenchmark::timing( QVector<qint64>& samples )
+    {
+
+        std::sort( samples.begin(), samples.end() );
+        qint64 total( 0 );
+        for( const qint64 sample:std::as_const( samples ) ) total += sample;
+
+        QJsonObject out;
+        out.insert( QStringLiteral( "min" ), percentile( samples, 0 ) );
+        out.insert( QStringLiteral( "median" ), percentile( samples, 0.5 ) );
+        out.insert( QStringLiteral( "p95" ), percentile( samples, 0.95 ) );
+        out.insert( QStringLiteral( "p99" ), percentile( samples, 0.99 ) );
+        out.insert( QStringLiteral( "max" ), percentile( samples, 1 ) );
+        out.insert( QStringLiteral( "total" ), total/1000.0 );
+        return out;
+
+    }
+
+    //_______________________________________________
+    QJsonObject HeadlessBenchmark::run( KPageWidgetItem* item )
+    {
+
+        QWidget* widget( item->widget() );
+
+        // show page, and let initial layout and paint settle before measuring
+        _dialog.setCurrentPage( item );
+        _application.processEvents();
+
+        QVector<qint64> samples;
+        _application.setPaintSamples( &samples );
+
+        QElapsedTimer timer;
+        timer.start();
+        const double cpuStart( cpuTime() );
+
+        for( int i = 0; i < _repeat; ++i )
+        {
+            QMetaObject::invokeMethod( widget, "benchmark", Qt::DirectConnection );
+            _application.processEvents();
+        }
+
+        const double cpu( cpuTime() - cpuStart );
+        const qint64 wall( timer.nsecsElapsed() );
+
+        _application.setPaintSamples( nullptr );
+
+        // paint times in microseconds, cpu and wall times in milliseconds
+        QJsonObject out;
+        out.insert( QStringLiteral( "key" ), key( widget ) );
+        out.insert( QStringLiteral( "name" ), item->name() );
+        out.insert( QStringLiteral( "paintCount" ), samples.size() );
+        out.insert( QStringLiteral( "paintTime" ), timing( samples ) );
+        out.insert( QStringLiteral( "cpuTime" ), cpu );
+        out.insert( QStringLiteral( "wallTime" ), wall/1000000.0 );
+        return out;
+
+    }
+
+}
@@ -0,0 +1,115 @@
+#ifndef oxygenheadlessbenchmark_h
+#define oxygenheadlessbenchmark_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenheadlessbenchmark.h
+// run demo pages benchmarks unattended, and write timings as JSON
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QApplication>
+#include <QJsonObject>
+#include <QStringList>
+#include <QVector>
+
+class KPageWidgetItem;
+
+namespace Oxygen
+{
+
+    class DemoDialog;
+
+    //! application that can time paint events
+    class BenchmarkApplication: public QApplication
+    {
+
+        public:
+
+        //! constructor
+        BenchmarkApplication( int& argc, char** argv ):
+            QApplication( argc, argv )
+        {}
+
+        //! record paint event durations, in nanoseconds. Recording stops when null
+        void setPaintSamples( QVector<qint64>* value )
+        { _paintSamples = value; }
+
+        //! record durations of window update requests, each matching one rendered frame, in nanoseconds. Recording stops when null
+        void setFrameSamples( QVector<qint64>* value )
+        { _frameSamples = value; }
+
+        //! notify
+        bool notify( QObject*, QEvent* ) override;
+
+        private:
+
+        //! paint event durations
+        QVector<qint64>* _paintSamples = nullptr;
+
+        //! frame durations
+        QVector<qint64>* _frameSamples = nullptr;
+
+    };
+
+    //! run demo pages benchmarks unattended, and write timings as JSON
+    class HeadlessBenchmark
+    {
+
+        public:
+
+        //! constructor
+        explicit HeadlessBenchmark( BenchmarkApplication&, DemoDialog& );
+
+        //! restrict to pages matching any of the given keys. All pages with a benchmark are run otherwise
+        void setPages( const QStringList& value )
+        { _pages = value; }
+
+        //! number of times each page benchmark is run
+        void setRepeat( int value )
+        { _repeat = qMax( 1, value ); }
+
+        //! simulator delay, in milliseconds
+        void setDelay( int value )
+        { _delay = qMax( 0, value ); }
+
+        //! run and write results to given file, or standard output if empty or '-'
+        bool run( const QString& );
+
+        //! page key, from demo widget class name
+        static QString key( const QWidget* );
+
+        //! min, median, p95, p99, max and total of samples, in microseconds. Samples are sorted in place
+        static QJsonObject timing( QVector<qint64>& );
+
+        //! write JSON to given file, or standard output if empty or '-'
+        static bool write( const QJsonObject&, const QString& );
+
+        private:
+
+        //! run a single page
+        QJsonObject run( KPageWidgetItem* );
+
+        //! application
+        BenchmarkApplication& _application;
+
+        //! dialog
+        DemoDialog& _dialog;
+
+        //! selected pages
+        QStringList _pages;
+
+        //! repetitions
+        int _repeat = 1;
+
+        //! delay
+        int _delay = 0;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,570 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygeninputtrace.cpp
+// record real input sessions, and replay them as reproducible benchmarks
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygeninputtrace.h"
+#include "oxygenheadlessbenchmark.h"
+
+#include <QApplication>
+#include <QDataStream>
+#include <QFile>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QStyleHints>
+#include <QWheelEvent>
+#include <QWindow>
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //* file magic, 'OXYT'
+        const quint32 traceMagic = 0x4f585954;
+
+        //* file format version
+        const quint16 traceVersion = 1;
+
+        //* path component of a widget, among siblings
+        QString component( const QWidget* widget, const QList<const QWidget*>& siblings )
+        {
+
+            const QString className( QString::fromLatin1( widget->metaObject()->className() ) );
+            int index( 0 );
+            for( const QWidget* sibling:siblings )
+            {
+                if( sibling == widget ) break;
+                if( sibling->objectName() == widget->objectName() && QLatin1String( sibling->metaObject()->className() ) == className ) ++index;
+            }
+
+            QString out( className );
+            if( !widget->objectName().isEmpty() ) out += QLatin1Char( '#' ) + widget->objectName();
+            if( index > 0 ) out += QStringLiteral( "[%1]" ).arg( index );
+            return out;
+
+        }
+
+        //* visible top level widgets
+        QList<const QWidget*> topLevelWidgets( void )
+        {
+            QList<const QWidget*> out;
+            for( const QWidget* widget:QApplication::topLevelWidgets() )
+            { if( widget->isVisible() ) out.append( widget ); }
+            return out;
+        }
+
+        //* child widgets
+        QList<const QWidget*> childWidgets( const QWidget* parent )
+        {
+            QList<const QWidget*> out;
+            for( const QObject* child:parent->children() )
+            { if( child->isWidgetType() ) out.append( static_cast<const QWidget*>( child ) ); }
+            return out;
+        }
+
+        //* true for recorded event types
+        bool isRecorded( QEvent::Type type )
+        {
+            switch( type )
+            {
+                case QEvent::MouseButtonPress:
+                case QEvent::MouseButtonRelease:
+                case QEvent::MouseMove:
+                case QEvent::Wheel:
+                case QEvent::KeyPress:
+                case QEvent::KeyRelease:
+                case QEvent::Enter:
+                case QEvent::Leave:
+                return true;
+
+                default: return false;
+            }
+        }
+
+    }
+
+    //_______________________________________________
+    int InputTrace::pathIndex( const QString& path )
+    {
+        auto iter( _pathIndexes.constFind( path ) );
+        if( iter != _pathIndexes.constEnd() ) return iter.value();
+
+        _paths.append( path );
+        _pathIndexes.insert( path, _paths.size() - 1 );
+        return _paths.size() - 1;
+    }
+
+    //_______________________________________________
+    QString InputTrace::path( const QWidget* widget )
+    {
+
+        QStringList components;
+        for( ; widget; widget = widget->isWindow() ? nullptr : widget->parentWidget() )
+        { components.prepend( component( widget, widget->isWindow() ? topLevelWidgets() : childWidgets( widget->parentWidget() ) ) ); }
+
+        return components.join( QLatin1Char( '/' ) );
+
+    }
+
+    //_______________________________________________
+    QWidget* InputTrace::find( const QString& path )
+    {
+
+        const QStringList components( path.split( QLatin1Char( '/' ), Qt::SkipEmptyParts ) );
+        const QWidget* out( nullptr );
+        for( const QString& current:components )
+        {
+
+            const QList<const QWidget*> candidates( out ? childWidgets( out ) : topLevelWidgets() );
+            out = nullptr;
+            for( const QWidget* candidate:candidates )
+            {
+                if( component( candidate, candidates ) != current ) continue;
+                out = candidate;
+                break;
+            }
+
+            if( !out ) return nullptr;
+
+        }
+
+        return const_cast<QWidget*>( out );
+
+    }
+
+    //_______________________________________________
+    QWidget* InputTrace::widget( const QWindow* window )
+    {
+        for( QWidget* widget:QApplication::topLevelWidgets() )
+        { if( widget->windowHandle() == window ) return widget; }
+        return nullptr;
+    }
+
+    //_______________________________________________
+    bool InputTrace::save( const QString& fileName ) const
+    {
+
+        QFile file( fileName );
+        if( !file.open( QIODevice::WriteOnly|QIODevice::Truncate ) ) return false;
+
+        QDataStream stream( &file );
+        stream.setVersion( QDataStream::Qt_5_15 );
+        stream << traceMagic << traceVersion;
+
+        stream << quint32( _windows.size() );
+        for( const Window& window:_windows )
+        { stream << window._path << window._size; }
+
+        stream << _paths;
+
+        // event specific fields only
+        stream << quint32( _events.size() );
+        for( const Event& event:_events )
+        {
+            stream << event._time << quint16( event._type ) << qint32( event._window ) << qint32( event._widget ) << event._windowPosition << event._widgetPosition;
+            switch( event._type )
+            {
+                case QEvent::MouseButtonPress:
+                case QEvent::MouseButtonRelease:
+                case QEvent::MouseMove:
+                stream << qint32( event._button ) << qint32( event._buttons ) << qint32( event._modifiers );
+                break;
+
+                case QEvent::Wheel:
+                stream << qint32( event._buttons ) << qint32( event._modifiers ) << event._angleDelta << event._pixelDelta;
+                break;
+
+                case QEvent::KeyPress:
+                case QEvent::KeyRelease:
+                stream << qint32( event._key ) << qint32( event._modifiers ) << event._text << event._autoRepeat;
+                break;
+
+                default: break;
+            }
+        }
+
+        return stream.status() == QDataStream::Ok;
+
+    }
+
+    //_______________________________________________
+    bool InputTrace::load( const QString& fileName )
+    {
+
+        QFile file( fileName );
+        if( !file.open( QIODevice::ReadOnly ) ) return false;
+
+        QDataStream stream( &file );
+        stream.setVersion( QDataStream::Qt_5_15 );
+
+        quint32 magic( 0 );
+        quint16 version( 0 );
+        stream >> magic >> version;
+        if( magic != traceMagic || version != traceVersion ) return false;
+
+        quint32 count( 0 );
+        stream >> count;
+        _windows.clear();
+        for( quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i )
+        {
+            Window window;
+            stream >> window._path >> window._size;
+            _windows.append( window );
+        }
+
+        stream >> _paths;
+        _pathIndexes.clear();
+        for( int i = 0; i < _paths.size(); ++i ) _pathIndexes.insert( _paths[i], i );
+
+        stream >> count;
+        _events.clear();
+        for( quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i )
+        {
+            Event event;
+            quint16 type( 0 );
+            qint32 window( -1 );
+            qint32 widget( -1 );
+            stream >> event._time >> type >> window >> widget >> event._windowPosition >> event._widgetPosition;
+            event._type = QEvent::Type( type );
+            event._window = window;
+            event._widget = widget;
+
+            qint32 button( 0 );
+            qint32 buttons( 0 );
+            qint32 modifiers( 0 );
+            qint32 key( 0 );
+            switch( event._type )
+            {
+                case QEvent::MouseButtonPress:
+                case QEvent::MouseButtonRelease:
+                case QEvent::MouseMove:
+                stream >> button >> buttons >> modifiers;
+                break;
+
+                case QEvent::Wheel:
+                stream >> buttons >> modifiers >> event._angleDelta >> event._pixelDelta;
+                break;
+
+                case QEvent::KeyPress:
+                case QEvent::KeyRelease:
+                stream >> key >> modifiers >> event._text >> event._autoRepeat;
+                break;
+
+                default: break;
+            }
+
+            event._button = button;
+            event._buttons = buttons;
+            event._modifiers = modifiers;
+            event._key = key;
+            _events.append( event );
+        }
+
+        return stream.status() == QDataStream::Ok;
+
+    }
+
+    //_______________________________________________
+    InputRecorder::InputRecorder( QObject* parent ):
+        QObject( parent )
+    {}
+
+    //_______________________________________________
+    void InputRecorder::start( void )
+    {
+
+        _trace = InputTrace();
+        for( const QWidget* widget:topLevelWidgets() )
+        { _trace._windows.append( { InputTrace::path( widget ), widget->size() } ); }
+
+        _clock.start();
+        qApp->installEventFilter( this );
+
+    }
+
+    //_______________________________________________
+    void InputRecorder::stop( void )
+    { qApp->removeEventFilter( this ); }
+
+    //_______________________________________________
+    bool InputRecorder::eventFilter( QObject* object, QEvent* event )
+    {
+
+        // input reaches windows first, before being dispatched to widgets
+        if( object->isWindowType() && event->spontaneous() && isRecorded( event->type() ) )
+        { record( static_cast<QWindow*>( object ), event ); }
+
+        return false;
+
+    }
+
+    //_______________________________________________
+    void InputRecorder::record( QWindow* window, QEvent* event )
+    {
+
+        QWidget* topLevel( InputTrace::widget( window ) );
+        if( !topLevel ) return;
+
+        InputTrace::Event out;
+        out._time = quint32( _clock.elapsed() );
+        out._type = event->type();
+        out._window = _trace.pathIndex( InputTrace::path( topLevel ) );
+
+        QWidget* widget( topLevel );
+        switch( event->type() )
+        {
+
+            case QEvent::MouseButtonPress:
+            case QEvent::MouseButtonRelease:
+            case QEvent::MouseMove:
+            {
+                const QMouseEvent* mouseEvent( static_cast<QMouseEvent*>( event ) );
+                out._windowPosition = mouseEvent->pos();
+                out._button = mouseEvent->button();
+                out._buttons = mouseEvent->buttons();
+                out._modifiers = mouseEvent->modifiers();
+                break;
+            }
+
+            case QEvent::Wheel:
+            {
+                const QWheelEvent* wheelEvent( static_cast<QWheelEvent*>( event ) );
+                out._windowPosition = wheelEvent->position().toPoint();
+                out._buttons = wheelEvent->buttons();
+                out._modifiers = wheelEvent->modifiers();
+                out._angleDelta = wheelEvent->angleDelta();
+                out._pixelDelta = wheelEvent->pixelDelta();
+                break;
+            }
+
+            case QEvent::KeyPress:
+            case QEvent::KeyRelease:
+            {
+                const QKeyEvent* keyEvent( static_cast<QKeyEvent*>( event ) );
+                out._key = keyEvent->key();
+                out._modifiers = keyEvent->modifiers();
+                out._text = keyEvent->text();
+                out._autoRepeat = keyEvent->isAutoRepeat();
+
+                QWidget* focusWidget( QApplication::focusWidget() );
+                if( focusWidget && focusWidget->window() == topLevel ) widget = focusWidget;
+                break;
+            }
+
+            case QEvent::Enter:
+            out._windowPosition = static_cast<QEnterEvent*>( event )->pos();
+            break;
+
+            default: break;
+
+        }
+
+        // positions are also stored relative to the widget under the mouse, so that replay survives layout changes
+        if( event->type() != QEvent::KeyPress && event->type() != QEvent::KeyRelease )
+        {
+            if( QWidget* child = topLevel->childAt( out._windowPosition ) ) widget = child;
+        }
+
+        out._widget = _trace.pathIndex( InputTrace::path( widget ) );
+        out._widgetPosition = widget->mapFrom( topLevel, out._windowPosition );
+        _trace._events.append( out );
+
+    }
+
+    //_______________________________________________
+    InputReplay::InputReplay( BenchmarkApplication& application, const InputTrace& trace ):
+        _application( application ),
+        _trace( trace )
+    {}
+
+    //_______________________________________________
+    void InputReplay::start( void )
+    {
+
+        // restore recorded window sizes, for positions to match
+        for( const InputTrace::Window& window:_trace._windows )
+        {
+            if( QWidget* widget = InputTrace::find( window._path ) )
+            { widget->resize( window._size ); }
+        }
+
+        _application.processEvents();
+
+        _index = 0;
+        _missedEvents = 0;
+        _unresolvedWidgets = 0;
+        _frameSamples.clear();
+        _paintSamples.clear();
+        _application.setFrameSamples( &_frameSamples );
+        _application.setPaintSamples( &_paintSamples );
+
+        _clock.start();
+        scheduleNext();
+
+    }
+
+    //_______________________________________________
+    void InputReplay::scheduleNext( void )
+    {
+
+        if( _index >= _trace._events.size() )
+        {
+            // let the last frames render before stopping measurements
+            _application.processEvents();
+            _wallTime = _clock.nsecsElapsed();
+            _application.setFrameSamples( nullptr );
+            _application.setPaintSamples( nullptr );
+            emit finished();
+            return;
+        }
+
+        int delay( 0 );
+        if( _speed > 0 ) delay = qMax<int>( 0, _trace._events[_index]._time/_speed - _clock.elapsed() );
+        _timer.start( delay, this );
+
+    }
+
+    //_______________________________________________
+    void InputReplay::timerEvent( QTimerEvent* event )
+    {
+
+        if( event->timerId() != _timer.timerId() )
+        { return QObject::timerEvent( event ); }
+
+        _timer.stop();
+
+        // deliver all events that are due. As fast as possible means one event per event loop iteration
+        do { deliver( _trace._events[_index++] ); }
+        while( _speed > 0 && _index < _trace._events.size() && _trace._events[_index]._time/_speed <= _clock.elapsed() );
+
+        scheduleNext();
+
+    }
+
+    //_______________________________________________
+    bool InputReplay::deliver( const InputTrace::Event& event )
+    {
+
+        QWidget* topLevel( InputTrace::find( _trace._paths.value( event._window ) ) );
+        QWindow* window( topLevel ? topLevel->windowHandle():nullptr );
+        if( !window )
+        {
+            ++_missedEvents;
+            return false;
+        }
+
+        // map widget position back to the window when the widget is still there
+        QPoint position( event._windowPosition );
+        if( event._type != QEvent::KeyPress && event._type != QEvent::KeyRelease )
+        {
+            QWidget* widget( InputTrace::find( _trace._paths.value( event._widget ) ) );
+            if( widget && widget->window() == topLevel ) position = widget->mapTo( topLevel, event._widgetPosition );
+            else ++_unresolvedWidgets;
+        }
+
+        // events are sent to the window, which dispatches them to its widgets.
+        // Recorded timestamps are used, so that double clicks are detected regardless of replay speed
+        const QPointF local( position );
+        const QPointF global( window->mapToGlobal( position ) );
+        const Qt::KeyboardModifiers modifiers( event._modifiers );
+        switch( event._type )
+        {
+
+            case QEvent::MouseButtonPress:
+            case QEvent::MouseButtonRelease:
+            case QEvent::MouseMove:
+            {
+                const Qt::MouseButton button( event._button );
+                QMouseEvent mouseEvent( event._type, local, local, global, button, Qt::MouseButtons( event._buttons ), modifiers );
+                mouseEvent.setTimestamp( event._time );
+                QCoreApplication::sendEvent( window, &mouseEvent );
+
+                // the platform layer is bypassed, so double clicks must be synthesized here
+                if( event._type == QEvent::MouseButtonPress )
+                {
+                    const bool doubleClick(
+                        button == _lastPressButton &&
+                        event._time - _lastPressTime < quint32( QGuiApplication::styleHints()->mouseDoubleClickInterval() ) );
+
+                    if( doubleClick )
+                    {
+                        QMouseEvent doubleClickEvent( QEvent::MouseButtonDblClick, local, local, global, button, Qt::MouseButtons( event._buttons ), modifiers );
+                        doubleClickEvent.setTimestamp( event._time );
+                        QCoreApplication::sendEvent( window, &doubleClickEvent );
+                        _lastPressButton = Qt::NoButton;
+
+                    } else {
+
+                        _lastPressButton = button;
+                        _lastPressTime = event._time;
+
+                    }
+                }
+
+                return true;
+            }
+
+            case QEvent::Wheel:
+            {
+                QWheelEvent wheelEvent( local, global, event._pixelDelta, event._angleDelta, Qt::MouseButtons( event._buttons ), modifiers, Qt::NoScrollPhase, false );
+                wheelEvent.setTimestamp( event._time );
+                QCoreApplication::sendEvent( window, &wheelEvent );
+                return true;
+            }
+
+            case QEvent::KeyPress:
+            case QEvent::KeyRelease:
+            {
+                QKeyEvent keyEvent( event._type, event._key, modifiers, event._text, event._autoRepeat );
+                keyEvent.setTimestamp( event._time );
+                QCoreApplication::sendEvent( window, &keyEvent );
+                return true;
+            }
+
+            case QEvent::Enter:
+            {
+                QEnterEvent enterEvent( local, local, global );
+                QCoreApplication::sendEvent( window, &enterEvent );
+                return true;
+            }
+
+            case QEvent::Leave:
+            {
+                QEvent leaveEvent( QEvent::Leave );
+                QCoreApplication::sendEvent( window, &leaveEvent );
+                return true;
+            }
+
+            default: return false;
+
+        }
+
+    }
+
+    //_______________________________________________
+    QJsonObject InputReplay::results( void )
+    {
+
+        // frame and paint times in microseconds, wall time in milliseconds
+        QJsonObject out;
+        out.insert( QStringLiteral( "events" ), _trace._events.size() );
+        out.insert( QStringLiteral( "missedEvents" ), _missedEvents );
+        out.insert( QStringLiteral( "unresolvedWidgets" ), _unresolvedWidgets );
+        out.insert( QStringLiteral( "speed" ), _speed );
+        out.insert( QStringLiteral( "wallTime" ), _wallTime/1000000.0 );
+        out.insert( QStringLiteral( "frameCount" ), _frameSamples.size() );
+        out.insert( QStringLiteral( "frameTime" ), HeadlessBenchmark::timing( _frameSamples ) );
+        out.insert( QStringLiteral( "paintCount" ), _paintSamples.size() );
+        out.insert( QStringLiteral( "paintTime" ), HeadlessBenchmark::timing( _paintSamples ) );
+        return out;
+
+    }
+
+}
@@ -0,0 +1,254 @@
+#ifndef oxygeninputtrace_h
+#define oxygeninputtrace_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygeninputtrace.h
+// record real input sessions, and replay them as reproducible benchmarks
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QBasicTimer>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QPoint>
+#include <QSize>
+#include <QStringList>
+#include <QVector>
+#include <QWidget>
+
+class QWindow;
+
+namespace Oxygen
+{
+
+    class BenchmarkApplication;
+
+    //! recorded input session
+    class InputTrace
+    {
+
+        public:
+
+        //! recorded event
+        class Event
+        {
+            public:
+
+            //! time since start of recording, in milliseconds
+            quint32 _time = 0;
+
+            //! event type. One of mouse press, release and move, wheel, key press and release, enter and leave
+            QEvent::Type _type = QEvent::None;
+
+            //! index of window path
+            int _window = -1;
+
+            //! index of path of the widget under the mouse, or with focus for key events
+            int _widget = -1;
+
+            //! position in window
+            QPoint _windowPosition;
+
+            //! position in widget
+            QPoint _widgetPosition;
+
+            //! mouse button
+            int _button = 0;
+
+            //! mouse buttons
+            int _buttons = 0;
+
+            //! keyboard modifiers
+            int _modifiers = 0;
+
+            //! key
+            int _key = 0;
+
+            //! text
+            QString _text;
+
+            //! auto repeat
+            bool _autoRepeat = false;
+
+            //! wheel angle delta
+            QPoint _angleDelta;
+
+            //! wheel pixel delta
+            QPoint _pixelDelta;
+
+        };
+
+        //! window size at start of recording
+        class Window
+        {
+            public:
+
+            //! path
+            QString _path;
+
+            //! size
+            QSize _size;
+
+        };
+
+        //! windows
+        QVector<Window> _windows;
+
+        //! widget paths, referenced by events
+        QStringList _paths;
+
+        //! events
+        QVector<Event> _events;
+
+        //! index of a given path, added if needed
+        int pathIndex( const QString& );
+
+        //! load from file
+        bool load( const QString& );
+
+        //! save to file
+        bool save( const QString& ) const;
+
+        //! path of a widget, from its window
+        static QString path( const QWidget* );
+
+        //! find widget matching path
+        static QWidget* find( const QString& );
+
+        //! widget of a given window
+        static QWidget* widget( const QWindow* );
+
+        private:
+
+        //! path index
+        QHash<QString, int> _pathIndexes;
+
+    };
+
+    //! record input events delivered to windows
+    class InputRecorder: public QObject
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit InputRecorder( QObject* );
+
+        //! start recording
+        void start( void );
+
+        //! stop recording
+        void stop( void );
+
+        //! trace
+        const InputTrace& trace( void ) const
+        { return _trace; }
+
+        //! event filter
+        bool eventFilter( QObject*, QEvent* ) override;
+
+        private:
+
+        //! record event
+        void record( QWindow*, QEvent* );
+
+        //! trace
+        InputTrace _trace;
+
+        //! clock
+        QElapsedTimer _clock;
+
+    };
+
+    //! replay recorded input, and measure frames
+    class InputReplay: public QObject
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit InputReplay( BenchmarkApplication&, const InputTrace& );
+
+        //! speed factor. 1 replays at original speed, larger values faster, and 0 as fast as events can be processed
+        void setSpeed( qreal value )
+        { _speed = qMax<qreal>( 0, value ); }
+
+        //! start
+        void start( void );
+
+        //! results, once finished
+        QJsonObject results( void );
+
+        Q_SIGNALS:
+
+        //! emitted when all events are replayed
+        void finished( void );
+
+        protected:
+
+        //! timer event
+        void timerEvent( QTimerEvent* ) override;
+
+        private:
+
+        //! deliver a single event
+        bool deliver( const InputTrace::Event& );
+
+        //! schedule next event
+        void scheduleNext( void );
+
+        //! application
+        BenchmarkApplication& _application;
+
+        //! trace
+        const InputTrace& _trace;
+
+        //! speed
+        qreal _speed = 1;
+
+        //! next event
+        int _index = 0;
+
+        //! number of events whose window could not be found
+        int _missedEvents = 0;
+
+        //! number of events whose widget could not be found, delivered at their recorded window position
+        int _unresolvedWidgets = 0;
+
+        //! last pressed mouse button, used to synthesize double clicks
+        Qt::MouseButton _lastPressButton = Qt::NoButton;
+
+        //! time of last mouse press
+        quint32 _lastPressTime = 0;
+
+        //! clock
+        QElapsedTimer _clock;
+
+        //! timer
+        QBasicTimer _timer;
+
+        //! frame durations
+        QVector<qint64> _frameSamples;
+
+        //! paint durations
+        QVector<qint64> _paintSamples;
+
+        //! replay duration, in nanoseconds
+        qint64 _wallTime = 0;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenlayoutbenchmark.cpp
+// measure relayout time of a large form
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenlayoutbenchmark.h"
+
+#include <QApplication>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QGroupBox>
+#include <QLabel>
+#include <QPushButton>
+#include <QScrollBar>
+#include <QSpinBox>
+#include <QTextStream>
+
+#include <algorithm>
+
+namespace Oxygen
+{
+
+    //_______________________________________________
+    LayoutBenchmark::LayoutBenchmark( int widgetCount ):
+        _form( new QWidget() )
+    {
+
+        _layout = new QFormLayout( _form.data() );
+
+        // each row holds a label and a field
+        for( int row = 0; 2*row < widgetCount; ++row )
+        {
+
+            QWidget* field( nullptr );
+            const QString text( QStringLiteral( "Field %1" ).arg( row ) );
+            switch( row%6 )
+            {
+                case 0: field = new QPushButton( text ); break;
+
+                case 1:
+                {
+                    QComboBox* comboBox( new QComboBox() );
+                    comboBox->addItems( { text, QStringLiteral( "First item" ), QStringLiteral( "Second item" ) } );
+                    field = comboBox;
+                    break;
+                }
+
+                case 2: field = new QSpinBox(); break;
+                case 3: field = new QCheckBox( text ); break;
+                case 4: field = new QScrollBar( Qt::Horizontal ); break;
+
+                default:
+                {
+                    QGroupBox* groupBox( new QGroupBox( text ) );
+                    groupBox->setCheckable( true );
+                    groupBox->setMinimumHeight( 40 );
+                    field = groupBox;
+                    break;
+                }
+
+            }
+
+            QLabel* label( new QLabel( QStringLiteral( "&Label %1:" ).arg( row ) ) );
+            label->setBuddy( field );
+            _layout->addRow( label, field );
+
+            _widgets.append( label );
+            _widgets.append( field );
+
+        }
+
+    }
+
+    //_______________________________________________
+    void LayoutBenchmark::run( int iterations )
+    {
+
+        QTextStream out( stdout );
+
+        // initial layout and polish
+        QElapsedTimer timer;
+        timer.start();
+        _form->show();
+        _layout->activate();
+        qApp->processEvents();
+        const qint64 initial( timer.nsecsElapsed() );
+
+        // repeated relayouts
+        QVector<qint64> samples;
+        samples.reserve( iterations );
+        for( int i = 0; i < iterations; ++i )
+        {
+            timer.restart();
+            relayout( i );
+            samples.append( timer.nsecsElapsed() );
+        }
+
+        out
+            << "widgets: " << _widgets.size() << "\n"
+            << "initial layout: " << initial/1000 << " us" << "\n";
+
+        if( samples.isEmpty() ) return;
+
+        std::sort( samples.begin(), samples.end() );
+        qint64 total( 0 );
+        for( const qint64 sample:samples ) total += sample;
+
+        out
+            << "relayouts: " << samples.size() << "\n"
+            << "relayout min: " << samples.first()/1000 << " us" << "\n"
+            << "relayout median: " << samples[samples.size()/2]/1000 << " us" << "\n"
+            << "relayout mean: " << total/samples.size()/1000 << " us" << "\n";
+
+    }
+
+    //_______________________________________________
+    void LayoutBenchmark::relayout( int iteration )
+    {
+
+        // a style change discards the size hints widgets cache internally,
+        // so that every widget goes through sizeFromContents again
+        for( QWidget* widget:_widgets )
+        {
+            QEvent event( QEvent::StyleChange );
+            QApplication::sendEvent( widget, &event );
+        }
+
+        // alternate the form width so that geometries are recomputed too
+        _form->resize( _form->sizeHint() + QSize( ( iteration%2 ) ? 20:0, 0 ) );
+        _layout->activate();
+
+    }
+
+}
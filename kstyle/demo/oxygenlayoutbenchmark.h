@@ -0,0 +1,52 @@
+#ifndef oxygenlayoutbenchmark_h
+#define oxygenlayoutbenchmark_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenlayoutbenchmark.h
+// measure relayout time of a large form
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QFormLayout>
+#include <QScopedPointer>
+#include <QVector>
+#include <QWidget>
+
+namespace Oxygen
+{
+
+    //! relayout a form with a large number of widgets and report timings
+    class LayoutBenchmark
+    {
+
+        public:
+
+        //! constructor
+        explicit LayoutBenchmark( int widgetCount = 2000 );
+
+        //! run given number of relayouts and print timings to standard output
+        void run( int iterations );
+
+        private:
+
+        //! force all widgets to recompute their size hints, and relayout
+        void relayout( int );
+
+        //! form
+        QScopedPointer<QWidget> _form;
+
+        //! layout
+        QFormLayout* _layout = nullptr;
+
+        //! widgets
+        QVector<QWidget*> _widgets;
+
+    };
+
+}
+
+#endif
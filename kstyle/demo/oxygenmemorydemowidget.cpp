@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenmemorydemowidget.cpp
+// report memory held by the style
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenmemorydemowidget.h"
+
+#include <QApplication>
+#include <QHBoxLayout>
+#include <QHash>
+#include <QHeaderView>
+#include <QIcon>
+#include <QLabel>
+#include <QLocale>
+#include <QProxyStyle>
+#include <QPushButton>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+#include <KLocalizedString>
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //! tree widget item sorting numeric columns by value
+        class Item: public QTreeWidgetItem
+        {
+            public:
+
+            //! constructor
+            explicit Item( QTreeWidgetItem* parent ):
+                QTreeWidgetItem( parent )
+            {}
+
+            //! less than operator
+            bool operator < ( const QTreeWidgetItem& other ) const override
+            {
+                const int column( treeWidget() ? treeWidget()->sortColumn():0 );
+                if( column < 1 ) return QTreeWidgetItem::operator < ( other );
+                else return data( column, Qt::UserRole ).toLongLong() < other.data( column, Qt::UserRole ).toLongLong();
+            }
+
+        };
+
+    }
+
+    //______________________________________________________________
+    MemoryDemoWidget::MemoryDemoWidget( QWidget* parent ):
+        DemoWidget( parent )
+    {
+
+        QVBoxLayout* vLayout( new QVBoxLayout( this ) );
+        vLayout->setContentsMargins( 0, 0, 0, 0 );
+
+        _treeWidget = new QTreeWidget( this );
+        _treeWidget->setHeaderLabels( { i18n( "Name" ), i18n( "Count" ), i18n( "Bytes" ) } );
+        _treeWidget->setRootIsDecorated( true );
+        _treeWidget->setSortingEnabled( true );
+        _treeWidget->header()->setSectionResizeMode( 0, QHeaderView::Stretch );
+        vLayout->addWidget( _treeWidget );
+
+        QHBoxLayout* hLayout( new QHBoxLayout() );
+        vLayout->addLayout( hLayout );
+
+        _totalLabel = new QLabel( this );
+        hLayout->addWidget( _totalLabel, 1 );
+
+        QPushButton* button( new QPushButton( i18n( "Clear Caches" ), this ) );
+        connect( button, SIGNAL(clicked()), SLOT(invalidateCaches()) );
+        hLayout->addWidget( button );
+
+        button = new QPushButton( QIcon::fromTheme( QStringLiteral( "view-refresh" ) ), i18n( "Refresh" ), this );
+        connect( button, SIGNAL(clicked()), SLOT(refresh()) );
+        hLayout->addWidget( button );
+
+    }
+
+    //______________________________________________________________
+    QVariantList MemoryDemoWidget::footprint( QStyle* style )
+    {
+
+        // the style is loaded as a plugin, so the report is retrieved through the meta object
+        if( QProxyStyle* proxy = qobject_cast<QProxyStyle*>( style ) ) style = proxy->baseStyle();
+
+        QVariantList out;
+        if( !( style && style->metaObject()->indexOfMethod( "memoryFootprint()" ) >= 0 ) ) return out;
+
+        QMetaObject::invokeMethod( style, "memoryFootprint", Qt::DirectConnection, Q_RETURN_ARG( QVariantList, out ) );
+        return out;
+
+    }
+
+    //______________________________________________________________
+    void MemoryDemoWidget::refresh( void )
+    {
+
+        _treeWidget->clear();
+
+        const QVariantList entries( footprint( style() ) );
+        if( entries.isEmpty() )
+        {
+            _totalLabel->setText( i18n( "Memory footprint is not available for this style" ) );
+            return;
+        }
+
+        // one top level item per category, with totals
+        const QLocale locale;
+        QHash<QString, QTreeWidgetItem*> categories;
+        qint64 total( 0 );
+        for( const QVariant& entry:entries )
+        {
+
+            const QVariantMap map( entry.toMap() );
+            const QString category( map.value( QStringLiteral( "category" ) ).toString() );
+            const qint64 count( map.value( QStringLiteral( "count" ) ).toLongLong() );
+            const qint64 bytes( map.value( QStringLiteral( "bytes" ) ).toLongLong() );
+
+            QTreeWidgetItem*& parent( categories[category] );
+            if( !parent )
+            {
+                parent = new Item( _treeWidget->invisibleRootItem() );
+                parent->setText( 0, category );
+                parent->setData( 1, Qt::UserRole, qint64( 0 ) );
+                parent->setData( 2, Qt::UserRole, qint64( 0 ) );
+            }
+
+            QTreeWidgetItem* item( new Item( parent ) );
+            item->setText( 0, map.value( QStringLiteral( "name" ) ).toString() );
+            item->setText( 1, locale.toString( count ) );
+            item->setText( 2, locale.toString( bytes ) );
+            item->setData( 1, Qt::UserRole, count );
+            item->setData( 2, Qt::UserRole, bytes );
+            for( int column = 1; column < 3; ++column )
+            { item->setTextAlignment( column, Qt::AlignRight|Qt::AlignVCenter ); }
+
+            parent->setData( 1, Qt::UserRole, parent->data( 1, Qt::UserRole ).toLongLong() + count );
+            parent->setData( 2, Qt::UserRole, parent->data( 2, Qt::UserRole ).toLongLong() + bytes );
+            total += bytes;
+
+        }
+
+        for( QTreeWidgetItem* parent:std::as_const( categories ) )
+        {
+            for( int column = 1; column < 3; ++column )
+            {
+                parent->setText( column, locale.toString( parent->data( column, Qt::UserRole ).toLongLong() ) );
+                parent->setTextAlignment( column, Qt::AlignRight|Qt::AlignVCenter );
+            }
+        }
+
+        _treeWidget->expandAll();
+        _totalLabel->setText( i18n( "Total: %1", locale.formattedDataSize( total ) ) );
+
+    }
+
+    //______________________________________________________________
+    void MemoryDemoWidget::showEvent( QShowEvent* event )
+    {
+        refresh();
+        DemoWidget::showEvent( event );
+    }
+
+    //______________________________________________________________
+    void MemoryDemoWidget::invalidateCaches( void )
+    {
+        QStyle* style( this->style() );
+        if( QProxyStyle* proxy = qobject_cast<QProxyStyle*>( style ) ) style = proxy->baseStyle();
+        if( style->metaObject()->indexOfSlot( "invalidateCaches()" ) >= 0 )
+        { QMetaObject::invokeMethod( style, "invalidateCaches", Qt::DirectConnection ); }
+
+        refresh();
+    }
+
+}
@@ -0,0 +1,76 @@
+#ifndef oxygenmemorydemowidget_h
+#define oxygenmemorydemowidget_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenmemorydemowidget.h
+// report memory held by the style
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygendemowidget.h"
+
+#include <QVariantList>
+#include <QWidget>
+
+class QLabel;
+class QStyle;
+class QTreeWidget;
+
+namespace Oxygen
+{
+
+    //! report memory held by the style caches, animation data and helper widgets
+    /*!
+    the report is refreshed when the page is shown, and when run from the benchmark page,
+    so that it reflects the state after all other selected pages have been exercised
+    */
+    class MemoryDemoWidget: public DemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit MemoryDemoWidget( QWidget* = nullptr );
+
+        //! memory footprint of a given style, as a list of maps with category, name, count and bytes keys
+        /*! empty if the style does not report its footprint */
+        static QVariantList footprint( QStyle* );
+
+        public Q_SLOTS:
+
+        //! refresh report
+        void benchmark( void )
+        { refresh(); }
+
+        //! refresh report
+        void refresh( void );
+
+        protected:
+
+        //! show event
+        void showEvent( QShowEvent* ) override;
+
+        private Q_SLOTS:
+
+        //! invalidate style caches
+        void invalidateCaches( void );
+
+        private:
+
+        //! report
+        QTreeWidget* _treeWidget = nullptr;
+
+        //! total
+        QLabel* _totalLabel = nullptr;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,222 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenpixeloracle.cpp
+// compare cached rendering of style elements against rendering with caches disabled
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenpixeloracle.h"
+#include "oxygenprimitivebenchmark.h"
+
+#include <QDir>
+
+#include <cstdlib>
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //* largest channel delta between two premultiplied pixels
+        int delta( QRgb first, QRgb second )
+        {
+            return qMax(
+                qMax( std::abs( qRed( first ) - qRed( second ) ), std::abs( qGreen( first ) - qGreen( second ) ) ),
+                qMax( std::abs( qBlue( first ) - qBlue( second ) ), std::abs( qAlpha( first ) - qAlpha( second ) ) ) );
+        }
+
+        //* render case into a transparent image of matching size and device pixel ratio
+        QImage render( const QStyle* style, const PrimitiveBenchmark::Case& current, const PrimitiveBenchmark::State& state, qreal devicePixelRatio )
+        {
+            QImage image( current._size*devicePixelRatio, QImage::Format_ARGB32_Premultiplied );
+            image.setDevicePixelRatio( devicePixelRatio );
+            image.fill( Qt::transparent );
+
+            QPainter painter( &image );
+            PrimitiveBenchmark::render( style, current, state, &painter );
+            return image;
+        }
+
+    }
+
+    //_______________________________________________
+    PixelOracle::PixelOracle( QStyle* style ):
+        _style( style )
+    {}
+
+    //_______________________________________________
+    PixelOracle::Difference PixelOracle::compare( const QImage& first, const QImage& second )
+    {
+
+        Difference out;
+        if( first.size() != second.size() || first.isNull() ) return out;
+
+        const QImage a( first.convertToFormat( QImage::Format_ARGB32_Premultiplied ) );
+        const QImage b( second.convertToFormat( QImage::Format_ARGB32_Premultiplied ) );
+
+        qint64 total( 0 );
+        for( int y = 0; y < a.height(); ++y )
+        {
+            const QRgb* firstLine( reinterpret_cast<const QRgb*>( a.constScanLine( y ) ) );
+            const QRgb* secondLine( reinterpret_cast<const QRgb*>( b.constScanLine( y ) ) );
+            for( int x = 0; x < a.width(); ++x )
+            {
+                const int value( delta( firstLine[x], secondLine[x] ) );
+                if( !value ) continue;
+
+                out._max = qMax( out._max, value );
+                total += value;
+                ++out._count;
+            }
+        }
+
+        out._mean = qreal( total )/( qint64( a.width() )*a.height() );
+        return out;
+
+    }
+
+    //_______________________________________________
+    QImage PixelOracle::difference( const QImage& first, const QImage& second )
+    {
+
+        // differing pixels in red, scaled so that small deltas remain visible, over a faded copy of the reference
+        QImage out( first.size(), QImage::Format_ARGB32_Premultiplied );
+        out.fill( Qt::transparent );
+        if( first.size() != second.size() ) return out;
+
+        const QImage a( first.convertToFormat( QImage::Format_ARGB32_Premultiplied ) );
+        const QImage b( second.convertToFormat( QImage::Format_ARGB32_Premultiplied ) );
+        for( int y = 0; y < a.height(); ++y )
+        {
+            const QRgb* firstLine( reinterpret_cast<const QRgb*>( a.constScanLine( y ) ) );
+            const QRgb* secondLine( reinterpret_cast<const QRgb*>( b.constScanLine( y ) ) );
+            QRgb* outLine( reinterpret_cast<QRgb*>( out.scanLine( y ) ) );
+            for( int x = 0; x < a.width(); ++x )
+            {
+                const int value( delta( firstLine[x], secondLine[x] ) );
+                if( value ) outLine[x] = qRgba( qMin( 255, 64 + 8*value ), 0, 0, 255 );
+                else {
+                    const int gray( qGray( firstLine[x] )/4 );
+                    outLine[x] = qRgba( gray, gray, gray, 255 );
+                }
+            }
+        }
+
+        return out;
+
+    }
+
+    //_______________________________________________
+    bool PixelOracle::run( QTextStream& out )
+    {
+
+        out << "element\tstate\tsize\tdpr\tmax\tmean\tpixels\tresult\n";
+
+        QDir dumpDirectory;
+        if( !_dumpDirectory.isEmpty() )
+        {
+            dumpDirectory.setPath( _dumpDirectory );
+            dumpDirectory.mkpath( QStringLiteral( "." ) );
+        }
+
+        const QVector<PrimitiveBenchmark::State> states( PrimitiveBenchmark::states() );
+        const QVector<int> scales = { 1, 2 };
+        const QVector<qreal> devicePixelRatios = { 1.0, 2.0 };
+
+        int failures( 0 );
+        int comparisons( 0 );
+        for( const PrimitiveBenchmark::Case& current:PrimitiveBenchmark::cases() )
+        {
+
+            if( !( _filter.isEmpty() || current._name.contains( _filter, Qt::CaseInsensitive ) ) ) continue;
+            const Tolerance tolerance( this->tolerance( current._name ) );
+
+            // all combinations of state, size and device pixel ratio
+            class Variant
+            {
+                public:
+                const PrimitiveBenchmark::State* _state;
+                PrimitiveBenchmark::Case _case;
+                qreal _devicePixelRatio;
+                QImage _reference;
+            };
+
+            QVector<Variant> variants;
+            for( const PrimitiveBenchmark::State& state:states )
+            for( const int scale:scales )
+            for( const qreal devicePixelRatio:devicePixelRatios )
+            {
+                if( !PrimitiveBenchmark::accepts( current, state ) ) continue;
+                PrimitiveBenchmark::Case scaled( current );
+                scaled._size = current._size*scale;
+                variants.append( { &state, scaled, devicePixelRatio, QImage() } );
+            }
+
+            // animated states are rendered half way through the hover animation, for both reference and fast path
+            PrimitiveBenchmark::startAnimation( _style, current );
+
+            // reference: tilesets and pixmaps generated afresh for every call
+            QMetaObject::invokeMethod( _style, "setCachesEnabled", Qt::DirectConnection, Q_ARG( bool, false ) );
+            for( Variant& variant:variants )
+            { variant._reference = render( _style, variant._case, *variant._state, variant._devicePixelRatio ); }
+
+            // warm caches with every state, size and device pixel ratio, so that each comparison
+            // below is served from caches that also hold entries for the other variants.
+            // Caches are not invalidated again, so stale entries and key collisions show up
+            QMetaObject::invokeMethod( _style, "setCachesEnabled", Qt::DirectConnection, Q_ARG( bool, true ) );
+            for( const Variant& variant:std::as_const( variants ) )
+            { render( _style, variant._case, *variant._state, variant._devicePixelRatio ); }
+
+            // fast path, in reverse order, so that the last variant rendered is never the one compared
+            for( auto iter = variants.crbegin(); iter != variants.crend(); ++iter )
+            {
+
+                const PrimitiveBenchmark::State& state( *iter->_state );
+                const PrimitiveBenchmark::Case& scaled( iter->_case );
+                const qreal devicePixelRatio( iter->_devicePixelRatio );
+                const QImage& reference( iter->_reference );
+                const QImage fast( render( _style, scaled, state, devicePixelRatio ) );
+
+                const Difference result( compare( reference, fast ) );
+                const bool accepted( tolerance.accepts( result ) );
+                ++comparisons;
+
+                out
+                    << current._name << "\t"
+                    << state._name << "\t"
+                    << scaled._size.width() << "x" << scaled._size.height() << "\t"
+                    << devicePixelRatio << "\t"
+                    << result._max << "\t"
+                    << result._mean << "\t"
+                    << result._count << "\t"
+                    << ( accepted ? "ok":"FAIL" ) << "\n";
+
+                if( accepted ) continue;
+                ++failures;
+
+                if( _dumpDirectory.isEmpty() ) continue;
+                const QString prefix( QStringLiteral( "%1-%2-%3x%4@%5" )
+                    .arg( current._name, state._name )
+                    .arg( scaled._size.width() ).arg( scaled._size.height() ).arg( devicePixelRatio ) );
+
+                reference.save( dumpDirectory.filePath( prefix + QStringLiteral( "-reference.png" ) ) );
+                fast.save( dumpDirectory.filePath( prefix + QStringLiteral( "-fast.png" ) ) );
+                difference( reference, fast ).save( dumpDirectory.filePath( prefix + QStringLiteral( "-difference.png" ) ) );
+
+            }
+
+        }
+
+        // leave caches in their configured state
+        QMetaObject::invokeMethod( _style, "setCachesEnabled", Qt::DirectConnection, Q_ARG( bool, true ) );
+
+        out << "# " << comparisons - failures << "/" << comparisons << " within tolerance\n";
+        return failures == 0;
+
+    }
+
+}
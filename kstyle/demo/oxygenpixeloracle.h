@@ -0,0 +1,119 @@
+#ifndef oxygenpixeloracle_h
+#define oxygenpixeloracle_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenpixeloracle.h
+// compare cached rendering of style elements against rendering with caches disabled
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QHash>
+#include <QImage>
+#include <QStyle>
+#include <QTextStream>
+
+namespace Oxygen
+{
+
+    //! render every element benchmarked by PrimitiveBenchmark with caches disabled (reference) and enabled (fast path), and compare
+    /**
+    with caches disabled, tilesets and pixmaps are generated by the same code, only rebuilt on every call.
+    The reference is therefore not independent: differences point to cache keying and stale entries,
+    while rendering errors in the generated tilesets and pixmaps show up identically in both
+    */
+    class PixelOracle
+    {
+
+        public:
+
+        //! constructor
+        explicit PixelOracle( QStyle* );
+
+        //! per pixel difference between two images
+        class Difference
+        {
+            public:
+
+            //! largest channel delta, over all pixels
+            int _max = 0;
+
+            //! largest channel delta, averaged over all pixels
+            qreal _mean = 0;
+
+            //! number of pixels that differ
+            int _count = 0;
+
+        };
+
+        //! allowed difference
+        class Tolerance
+        {
+            public:
+
+            //! largest channel delta
+            int _max = 0;
+
+            //! mean channel delta
+            qreal _mean = 0;
+
+            //! true if difference is within tolerance
+            bool accepts( const Difference& difference ) const
+            { return difference._max <= _max && difference._mean <= _mean; }
+
+        };
+
+        //! only compare elements whose name contains filter
+        void setFilter( const QString& value )
+        { _filter = value; }
+
+        //! default tolerance
+        void setTolerance( const Tolerance& value )
+        { _tolerance = value; }
+
+        //! tolerance for a given element, overriding the default
+        void setTolerance( const QString& element, const Tolerance& value )
+        { _tolerances.insert( element, value ); }
+
+        //! directory where reference, fast path and difference images are written for failing comparisons. Nothing is written if empty
+        void setDumpDirectory( const QString& value )
+        { _dumpDirectory = value; }
+
+        //! run and print results to given stream. Returns true if all comparisons are within tolerance
+        bool run( QTextStream& );
+
+        //! compare two images of identical size
+        static Difference compare( const QImage&, const QImage& );
+
+        //! image highlighting differing pixels
+        static QImage difference( const QImage&, const QImage& );
+
+        private:
+
+        //! tolerance for a given element
+        Tolerance tolerance( const QString& element ) const
+        { return _tolerances.value( element, _tolerance ); }
+
+        //! style
+        QStyle* _style;
+
+        //! filter
+        QString _filter;
+
+        //! default tolerance
+        Tolerance _tolerance;
+
+        //! per element tolerances
+        QHash<QString, Tolerance> _tolerances;
+
+        //! dump directory
+        QString _dumpDirectory;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,444 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenprimitivebenchmark.cpp
+// measure rendering time of individual style elements
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenprimitivebenchmark.h"
+
+#include <QAbstractAnimation>
+#include <QApplication>
+#include <QCheckBox>
+#include <QDial>
+#include <QElapsedTimer>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QRadioButton>
+#include <QToolButton>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//* number of operator new calls
+/** pixel buffers are allocated with malloc and are not counted */
+static std::atomic<quint64> allocationCount( 0 );
+
+//__________________________________________
+void* operator new( std::size_t size )
+{
+    ++allocationCount;
+    if( void* pointer = std::malloc( size ? size:1 ) ) return pointer;
+    throw std::bad_alloc();
+}
+
+//__________________________________________
+void* operator new[]( std::size_t size )
+{
+    ++allocationCount;
+    if( void* pointer = std::malloc( size ? size:1 ) ) return pointer;
+    throw std::bad_alloc();
+}
+
+//__________________________________________
+void operator delete( void* pointer ) noexcept
+{ std::free( pointer ); }
+
+//__________________________________________
+void operator delete[]( void* pointer ) noexcept
+{ std::free( pointer ); }
+
+//__________________________________________
+void operator delete( void* pointer, std::size_t ) noexcept
+{ std::free( pointer ); }
+
+//__________________________________________
+void operator delete[]( void* pointer, std::size_t ) noexcept
+{ std::free( pointer ); }
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //* initialize option the way QStyleOption::initFrom would, without a widget
+        template<typename T>
+        QSharedPointer<T> createOption( void )
+        {
+            QSharedPointer<T> option( new T() );
+            option->palette = QApplication::palette();
+            option->fontMetrics = QFontMetrics( QApplication::font() );
+            option->direction = Qt::LeftToRight;
+            return option;
+        }
+
+        //* case
+        PrimitiveBenchmark::Case createCase( const QString& name, PrimitiveBenchmark::Kind kind, int element, const QSize& size, const QSharedPointer<QStyleOption>& option, QStyle::State state = QStyle::State_None )
+        {
+            PrimitiveBenchmark::Case out;
+            out._name = name;
+            out._kind = kind;
+            out._element = element;
+            out._size = size;
+            out._option = option;
+            out._state = state;
+            return out;
+        }
+
+        //* case rendered with a widget of given type, so that animated states are covered too
+        template<typename T>
+        PrimitiveBenchmark::Case createAnimatedCase( const QString& name, PrimitiveBenchmark::Kind kind, int element, const QSize& size, const QSharedPointer<QStyleOption>& option, QStyle::State state = QStyle::State_None )
+        {
+            PrimitiveBenchmark::Case out( createCase( name, kind, element, size, option, state ) );
+            out._widget.reset( new T() );
+            out._widget->resize( size );
+            return out;
+        }
+
+    }
+
+    //_______________________________________________
+    PrimitiveBenchmark::PrimitiveBenchmark( QStyle* style ):
+        _style( style )
+    {}
+
+    //_______________________________________________
+    quint64 PrimitiveBenchmark::allocations( void )
+    { return allocationCount; }
+
+    //_______________________________________________
+    QVector<PrimitiveBenchmark::State> PrimitiveBenchmark::states( void )
+    {
+        return {
+            { QStringLiteral( "normal" ), QStyle::State_Enabled|QStyle::State_Active },
+            { QStringLiteral( "hover" ), QStyle::State_Enabled|QStyle::State_Active|QStyle::State_MouseOver },
+            { QStringLiteral( "focus" ), QStyle::State_Enabled|QStyle::State_Active|QStyle::State_HasFocus },
+            { QStringLiteral( "sunken" ), QStyle::State_Enabled|QStyle::State_Active|QStyle::State_Sunken },
+            { QStringLiteral( "disabled" ), QStyle::State_Active },
+            { QStringLiteral( "animated" ), QStyle::State_Enabled|QStyle::State_Active|QStyle::State_MouseOver, true }
+        };
+    }
+
+    //_______________________________________________
+    QVector<PrimitiveBenchmark::Case> PrimitiveBenchmark::cases( void )
+    {
+
+        QVector<Case> out;
+
+        // generic
+        const auto option( createOption<QStyleOption>() );
+
+        // buttons
+        const auto button( createOption<QStyleOptionButton>() );
+        button->text = QStringLiteral( "Button" );
+
+        const auto checkBox( createOption<QStyleOptionButton>() );
+
+        const auto toolButton( createOption<QStyleOptionToolButton>() );
+        toolButton->text = QStringLiteral( "Tool" );
+        toolButton->toolButtonStyle = Qt::ToolButtonTextOnly;
+        toolButton->subControls = QStyle::SC_ToolButton;
+
+        // frames
+        const auto frame( createOption<QStyleOptionFrame>() );
+        frame->lineWidth = 1;
+        frame->frameShape = QFrame::StyledPanel;
+
+        const auto focusRect( createOption<QStyleOptionFocusRect>() );
+
+        // items
+        const auto viewItem( createOption<QStyleOptionViewItem>() );
+        viewItem->text = QStringLiteral( "Item" );
+        viewItem->features = QStyleOptionViewItem::HasDisplay;
+
+        const auto menuItem( createOption<QStyleOptionMenuItem>() );
+        menuItem->text = QStringLiteral( "Open\tCtrl+O" );
+        menuItem->menuItemType = QStyleOptionMenuItem::Normal;
+        menuItem->checkType = QStyleOptionMenuItem::NonExclusive;
+        menuItem->checked = true;
+        menuItem->maxIconWidth = 16;
+        menuItem->menuHasCheckableItems = true;
+
+        const auto menuBarItem( createOption<QStyleOptionMenuItem>() );
+        menuBarItem->text = QStringLiteral( "File" );
+        menuBarItem->menuItemType = QStyleOptionMenuItem::Normal;
+
+        const auto header( createOption<QStyleOptionHeader>() );
+        header->text = QStringLiteral( "Header" );
+        header->sortIndicator = QStyleOptionHeader::SortDown;
+        header->position = QStyleOptionHeader::Middle;
+
+        // tabs
+        const auto tab( createOption<QStyleOptionTab>() );
+        tab->text = QStringLiteral( "Tab" );
+        tab->shape = QTabBar::RoundedNorth;
+        tab->position = QStyleOptionTab::Middle;
+
+        const auto tabWidgetFrame( createOption<QStyleOptionTabWidgetFrame>() );
+        tabWidgetFrame->shape = QTabBar::RoundedNorth;
+        tabWidgetFrame->tabBarSize = QSize( 80, 28 );
+        tabWidgetFrame->lineWidth = 1;
+
+        const auto tabBarBase( createOption<QStyleOptionTabBarBase>() );
+        tabBarBase->shape = QTabBar::RoundedNorth;
+        tabBarBase->tabBarRect = QRect( 0, 0, 80, 28 );
+
+        // panels
+        const auto dockWidget( createOption<QStyleOptionDockWidget>() );
+        dockWidget->title = QStringLiteral( "Dock" );
+        dockWidget->closable = true;
+
+        const auto progressBar( createOption<QStyleOptionProgressBar>() );
+        progressBar->minimum = 0;
+        progressBar->maximum = 100;
+        progressBar->progress = 40;
+        progressBar->text = QStringLiteral( "40%" );
+        progressBar->textVisible = true;
+
+        const auto rubberBand( createOption<QStyleOptionRubberBand>() );
+        rubberBand->shape = QRubberBand::Rectangle;
+
+        const auto toolBar( createOption<QStyleOptionToolBar>() );
+        const auto toolBox( createOption<QStyleOptionToolBox>() );
+        toolBox->text = QStringLiteral( "Page" );
+
+        // complex controls
+        const auto comboBox( createOption<QStyleOptionComboBox>() );
+        comboBox->currentText = QStringLiteral( "Item" );
+        comboBox->frame = true;
+        comboBox->subControls = QStyle::SC_All;
+
+        const auto spinBox( createOption<QStyleOptionSpinBox>() );
+        spinBox->frame = true;
+        spinBox->stepEnabled = QAbstractSpinBox::StepUpEnabled|QAbstractSpinBox::StepDownEnabled;
+        spinBox->subControls = QStyle::SC_All;
+
+        const auto slider( createOption<QStyleOptionSlider>() );
+        slider->orientation = Qt::Horizontal;
+        slider->minimum = 0;
+        slider->maximum = 100;
+        slider->sliderPosition = 30;
+        slider->sliderValue = 30;
+        slider->pageStep = 20;
+        slider->subControls = QStyle::SC_SliderGroove|QStyle::SC_SliderHandle;
+
+        const auto dial( createOption<QStyleOptionSlider>() );
+        *dial = *slider;
+        dial->subControls = QStyle::SC_All;
+
+        const auto scrollBar( createOption<QStyleOptionSlider>() );
+        *scrollBar = *slider;
+        scrollBar->orientation = Qt::Vertical;
+        scrollBar->subControls = QStyle::SC_All;
+
+        const auto titleBar( createOption<QStyleOptionTitleBar>() );
+        titleBar->text = QStringLiteral( "Window" );
+        titleBar->titleBarFlags = Qt::Window|Qt::WindowTitleHint|Qt::WindowSystemMenuHint|Qt::WindowMinMaxButtonsHint|Qt::WindowCloseButtonHint;
+        titleBar->subControls = QStyle::SC_All;
+
+        const QStyle::State horizontal( QStyle::State_Horizontal );
+
+        // primitives
+        out
+            << createAnimatedCase<QPushButton>( QStringLiteral( "PE_PanelButtonCommand" ), Primitive, QStyle::PE_PanelButtonCommand, QSize( 80, 28 ), button )
+            << createCase( QStringLiteral( "PE_PanelButtonTool" ), Primitive, QStyle::PE_PanelButtonTool, QSize( 28, 28 ), toolButton )
+            << createCase( QStringLiteral( "PE_PanelScrollAreaCorner" ), Primitive, QStyle::PE_PanelScrollAreaCorner, QSize( 16, 16 ), option )
+            << createCase( QStringLiteral( "PE_PanelMenu" ), Primitive, QStyle::PE_PanelMenu, QSize( 120, 200 ), option )
+            << createCase( QStringLiteral( "PE_PanelTipLabel" ), Primitive, QStyle::PE_PanelTipLabel, QSize( 120, 30 ), frame )
+            << createCase( QStringLiteral( "PE_PanelItemViewItem" ), Primitive, QStyle::PE_PanelItemViewItem, QSize( 200, 22 ), viewItem, QStyle::State_Selected )
+            << createAnimatedCase<QCheckBox>( QStringLiteral( "PE_IndicatorCheckBox" ), Primitive, QStyle::PE_IndicatorCheckBox, QSize( 16, 16 ), checkBox, QStyle::State_On )
+            << createAnimatedCase<QRadioButton>( QStringLiteral( "PE_IndicatorRadioButton" ), Primitive, QStyle::PE_IndicatorRadioButton, QSize( 16, 16 ), checkBox, QStyle::State_On )
+            << createCase( QStringLiteral( "PE_IndicatorButtonDropDown" ), Primitive, QStyle::PE_IndicatorButtonDropDown, QSize( 14, 28 ), toolButton )
+            << createCase( QStringLiteral( "PE_IndicatorTabClose" ), Primitive, QStyle::PE_IndicatorTabClose, QSize( 16, 16 ), option )
+            << createCase( QStringLiteral( "PE_IndicatorTabTear" ), Primitive, QStyle::PE_IndicatorTabTear, QSize( 16, 28 ), tab )
+            << createCase( QStringLiteral( "PE_IndicatorArrowUp" ), Primitive, QStyle::PE_IndicatorArrowUp, QSize( 12, 12 ), option )
+            << createCase( QStringLiteral( "PE_IndicatorArrowDown" ), Primitive, QStyle::PE_IndicatorArrowDown, QSize( 12, 12 ), option )
+            << createCase( QStringLiteral( "PE_IndicatorArrowLeft" ), Primitive, QStyle::PE_IndicatorArrowLeft, QSize( 12, 12 ), option )
+            << createCase( QStringLiteral( "PE_IndicatorArrowRight" ), Primitive, QStyle::PE_IndicatorArrowRight, QSize( 12, 12 ), option )
+            << createCase( QStringLiteral( "PE_IndicatorMenuCheckMark" ), Primitive, QStyle::PE_IndicatorMenuCheckMark, QSize( 16, 16 ), menuItem, QStyle::State_On )
+            << createCase( QStringLiteral( "PE_IndicatorHeaderArrow" ), Primitive, QStyle::PE_IndicatorHeaderArrow, QSize( 12, 12 ), header )
+            << createCase( QStringLiteral( "PE_IndicatorToolBarHandle" ), Primitive, QStyle::PE_IndicatorToolBarHandle, QSize( 8, 28 ), option, horizontal )
+            << createCase( QStringLiteral( "PE_IndicatorToolBarSeparator" ), Primitive, QStyle::PE_IndicatorToolBarSeparator, QSize( 8, 28 ), option, horizontal )
+            << createCase( QStringLiteral( "PE_IndicatorBranch" ), Primitive, QStyle::PE_IndicatorBranch, QSize( 16, 16 ), option, QStyle::State_Children|QStyle::State_Open )
+            << createCase( QStringLiteral( "PE_IndicatorDockWidgetResizeHandle" ), Primitive, QStyle::PE_IndicatorDockWidgetResizeHandle, QSize( 100, 4 ), option, horizontal )
+            << createCase( QStringLiteral( "PE_Frame" ), Primitive, QStyle::PE_Frame, QSize( 120, 80 ), frame )
+            << createAnimatedCase<QLineEdit>( QStringLiteral( "PE_FrameLineEdit" ), Primitive, QStyle::PE_FrameLineEdit, QSize( 120, 28 ), frame )
+            << createCase( QStringLiteral( "PE_FrameMenu" ), Primitive, QStyle::PE_FrameMenu, QSize( 120, 200 ), option )
+            << createCase( QStringLiteral( "PE_FrameGroupBox" ), Primitive, QStyle::PE_FrameGroupBox, QSize( 160, 100 ), frame )
+            << createCase( QStringLiteral( "PE_FrameTabWidget" ), Primitive, QStyle::PE_FrameTabWidget, QSize( 200, 150 ), tabWidgetFrame )
+            << createCase( QStringLiteral( "PE_FrameTabBarBase" ), Primitive, QStyle::PE_FrameTabBarBase, QSize( 200, 4 ), tabBarBase )
+            << createCase( QStringLiteral( "PE_FrameWindow" ), Primitive, QStyle::PE_FrameWindow, QSize( 200, 150 ), option )
+            << createCase( QStringLiteral( "PE_FrameFocusRect" ), Primitive, QStyle::PE_FrameFocusRect, QSize( 80, 24 ), focusRect );
+
+        // controls
+        out
+            << createCase( QStringLiteral( "CE_DockWidgetTitle" ), Control, QStyle::CE_DockWidgetTitle, QSize( 150, 22 ), dockWidget )
+            << createCase( QStringLiteral( "CE_HeaderEmptyArea" ), Control, QStyle::CE_HeaderEmptyArea, QSize( 100, 24 ), option, horizontal )
+            << createCase( QStringLiteral( "CE_HeaderSection" ), Control, QStyle::CE_HeaderSection, QSize( 100, 24 ), header )
+            << createCase( QStringLiteral( "CE_MenuBarItem" ), Control, QStyle::CE_MenuBarItem, QSize( 50, 24 ), menuBarItem )
+            << createCase( QStringLiteral( "CE_MenuItem" ), Control, QStyle::CE_MenuItem, QSize( 180, 24 ), menuItem )
+            << createCase( QStringLiteral( "CE_ProgressBar" ), Control, QStyle::CE_ProgressBar, QSize( 200, 22 ), progressBar, horizontal )
+            << createCase( QStringLiteral( "CE_ProgressBarGroove" ), Control, QStyle::CE_ProgressBarGroove, QSize( 200, 22 ), progressBar, horizontal )
+            << createCase( QStringLiteral( "CE_ProgressBarContents" ), Control, QStyle::CE_ProgressBarContents, QSize( 200, 22 ), progressBar, horizontal )
+            << createCase( QStringLiteral( "CE_ProgressBarLabel" ), Control, QStyle::CE_ProgressBarLabel, QSize( 200, 22 ), progressBar, horizontal )
+            << createAnimatedCase<QPushButton>( QStringLiteral( "CE_PushButtonBevel" ), Control, QStyle::CE_PushButtonBevel, QSize( 80, 28 ), button )
+            << createCase( QStringLiteral( "CE_PushButtonLabel" ), Control, QStyle::CE_PushButtonLabel, QSize( 80, 28 ), button )
+            << createCase( QStringLiteral( "CE_RubberBand" ), Control, QStyle::CE_RubberBand, QSize( 100, 80 ), rubberBand )
+            << createCase( QStringLiteral( "CE_ScrollBarSlider" ), Control, QStyle::CE_ScrollBarSlider, QSize( 16, 60 ), scrollBar )
+            << createCase( QStringLiteral( "CE_ScrollBarAddLine" ), Control, QStyle::CE_ScrollBarAddLine, QSize( 16, 32 ), scrollBar )
+            << createCase( QStringLiteral( "CE_ScrollBarSubLine" ), Control, QStyle::CE_ScrollBarSubLine, QSize( 16, 32 ), scrollBar )
+            << createCase( QStringLiteral( "CE_ShapedFrame" ), Control, QStyle::CE_ShapedFrame, QSize( 120, 80 ), frame )
+            << createCase( QStringLiteral( "CE_Splitter" ), Control, QStyle::CE_Splitter, QSize( 6, 100 ), option )
+            << createCase( QStringLiteral( "CE_TabBarTabShape" ), Control, QStyle::CE_TabBarTabShape, QSize( 80, 28 ), tab )
+            << createCase( QStringLiteral( "CE_TabBarTabLabel" ), Control, QStyle::CE_TabBarTabLabel, QSize( 80, 28 ), tab )
+            << createCase( QStringLiteral( "CE_ToolBar" ), Control, QStyle::CE_ToolBar, QSize( 300, 32 ), toolBar, horizontal )
+            << createCase( QStringLiteral( "CE_ToolBoxTabShape" ), Control, QStyle::CE_ToolBoxTabShape, QSize( 200, 24 ), toolBox )
+            << createCase( QStringLiteral( "CE_ToolBoxTabLabel" ), Control, QStyle::CE_ToolBoxTabLabel, QSize( 200, 24 ), toolBox )
+            << createCase( QStringLiteral( "CE_ToolButtonLabel" ), Control, QStyle::CE_ToolButtonLabel, QSize( 60, 28 ), toolButton );
+
+        // complex controls
+        out
+            << createAnimatedCase<QToolButton>( QStringLiteral( "CC_ToolButton" ), ComplexControl, QStyle::CC_ToolButton, QSize( 60, 28 ), toolButton )
+            << createCase( QStringLiteral( "CC_ComboBox" ), ComplexControl, QStyle::CC_ComboBox, QSize( 120, 28 ), comboBox )
+            << createCase( QStringLiteral( "CC_SpinBox" ), ComplexControl, QStyle::CC_SpinBox, QSize( 80, 28 ), spinBox )
+            << createCase( QStringLiteral( "CC_Slider" ), ComplexControl, QStyle::CC_Slider, QSize( 160, 24 ), slider, horizontal )
+            << createAnimatedCase<QDial>( QStringLiteral( "CC_Dial" ), ComplexControl, QStyle::CC_Dial, QSize( 60, 60 ), dial )
+            << createCase( QStringLiteral( "CC_ScrollBar" ), ComplexControl, QStyle::CC_ScrollBar, QSize( 16, 200 ), scrollBar )
+            << createCase( QStringLiteral( "CC_TitleBar" ), ComplexControl, QStyle::CC_TitleBar, QSize( 300, 24 ), titleBar );
+
+        return out;
+
+    }
+
+    //_______________________________________________
+    void PrimitiveBenchmark::startAnimation( QStyle* style, const Case& current )
+    {
+
+        if( !current._widget ) return;
+
+        // widget is registered to the style animations on polish
+        if( current._widget->style() != style )
+        { current._widget->setStyle( style ); }
+
+        // render without, then with hover, so that the hover animation starts
+        QImage image( current._size, QImage::Format_ARGB32_Premultiplied );
+        image.fill( Qt::transparent );
+        QPainter painter( &image );
+        render( style, current, QStyle::State_Enabled|QStyle::State_Active, current._widget.data(), &painter );
+        render( style, current, QStyle::State_Enabled|QStyle::State_Active|QStyle::State_MouseOver, current._widget.data(), &painter );
+
+        // move running animations half way
+        const auto animations( style->findChildren<QAbstractAnimation*>() );
+        for( QAbstractAnimation* animation:animations )
+        {
+            if( animation->state() == QAbstractAnimation::Running )
+            { animation->setCurrentTime( animation->duration()/2 ); }
+        }
+
+    }
+
+    //_______________________________________________
+    void PrimitiveBenchmark::render( const QStyle* style, const Case& current, const State& state, QPainter* painter )
+    { render( style, current, state._state, state._animated ? current._widget.data():nullptr, painter ); }
+
+    //_______________________________________________
+    void PrimitiveBenchmark::render( const QStyle* style, const Case& current, QStyle::State state, const QWidget* widget, QPainter* painter )
+    {
+
+        QStyleOption* option( current._option.data() );
+        option->rect = QRect( QPoint(), current._size );
+        option->state = state|current._state;
+
+        switch( current._kind )
+        {
+            case Primitive:
+            style->drawPrimitive( QStyle::PrimitiveElement( current._element ), option, painter, widget );
+            break;
+
+            case Control:
+            style->drawControl( QStyle::ControlElement( current._element ), option, painter, widget );
+            break;
+
+            case ComplexControl:
+            style->drawComplexControl( QStyle::ComplexControl( current._element ), static_cast<const QStyleOptionComplex*>( option ), painter, widget );
+            break;
+        }
+
+    }
+
+    //_______________________________________________
+    void PrimitiveBenchmark::run( QTextStream& out )
+    {
+
+        out << "element\tstate\tsize\tdpr\tcold ns/op\tcold new/op\twarm ns/op\twarm new/op\n";
+
+        const QVector<State> states( this->states() );
+        const QVector<int> scales = { 1, 2 };
+        const QVector<qreal> devicePixelRatios = { 1.0, 2.0 };
+
+        for( const Case& current:cases() )
+        {
+
+            if( !( _filter.isEmpty() || current._name.contains( _filter, Qt::CaseInsensitive ) ) ) continue;
+
+            for( const State& state:states )
+            for( const int scale:scales )
+            for( const qreal devicePixelRatio:devicePixelRatios )
+            {
+
+                if( !accepts( current, state ) ) continue;
+                if( state._animated ) startAnimation( _style, current );
+
+                Case scaled( current );
+                scaled._size = current._size*scale;
+
+                QImage image( scaled._size*devicePixelRatio, QImage::Format_ARGB32_Premultiplied );
+                image.setDevicePixelRatio( devicePixelRatio );
+                image.fill( Qt::transparent );
+                QPainter painter( &image );
+
+                // cold caches. Only rendering is timed
+                QElapsedTimer timer;
+                qint64 coldTime( 0 );
+                quint64 coldAllocations( 0 );
+                for( int i = 0; i < _coldIterations; ++i )
+                {
+                    QMetaObject::invokeMethod( _style, "invalidateCaches", Qt::DirectConnection );
+                    const quint64 allocations( this->allocations() );
+                    timer.start();
+                    render( _style, scaled, state, &painter );
+                    coldTime += timer.nsecsElapsed();
+                    coldAllocations += this->allocations() - allocations;
+                }
+
+                // warm caches
+                render( _style, scaled, state, &painter );
+                const quint64 allocations( this->allocations() );
+                timer.start();
+                for( int i = 0; i < _iterations; ++i )
+                { render( _style, scaled, state, &painter ); }
+                const qint64 warmTime( timer.nsecsElapsed() );
+                const quint64 warmAllocations( this->allocations() - allocations );
+
+                out
+                    << current._name << "\t"
+                    << state._name << "\t"
+                    << scaled._size.width() << "x" << scaled._size.height() << "\t"
+                    << devicePixelRatio << "\t"
+                    << coldTime/_coldIterations << "\t"
+                    << qreal( coldAllocations )/_coldIterations << "\t"
+                    << warmTime/_iterations << "\t"
+                    << qreal( warmAllocations )/_iterations << "\n";
+
+            }
+
+        }
+
+    }
+
+}
@@ -0,0 +1,143 @@
+#ifndef oxygenprimitivebenchmark_h
+#define oxygenprimitivebenchmark_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenprimitivebenchmark.h
+// measure rendering time of individual style elements
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QPainter>
+#include <QSharedPointer>
+#include <QStyle>
+#include <QStyleOption>
+#include <QTextStream>
+#include <QVector>
+#include <QWidget>
+
+namespace Oxygen
+{
+
+    //! render every primitive, control and complex control the style implements, and report timings
+    class PrimitiveBenchmark
+    {
+
+        public:
+
+        //! constructor
+        explicit PrimitiveBenchmark( QStyle* );
+
+        //! only run elements whose name contains filter
+        void setFilter( const QString& value )
+        { _filter = value; }
+
+        //! iterations with warm caches
+        void setIterations( int value )
+        { _iterations = qMax( 1, value ); }
+
+        //! iterations with cold caches
+        void setColdIterations( int value )
+        { _coldIterations = qMax( 1, value ); }
+
+        //! run and print results to given stream, one tab separated line per element, state, size and device pixel ratio
+        void run( QTextStream& );
+
+        //! number of operator new calls since start
+        static quint64 allocations( void );
+
+        //! element kind
+        enum Kind
+        {
+            Primitive,
+            Control,
+            ComplexControl
+        };
+
+        //! rendered element
+        class Case
+        {
+            public:
+
+            //! name
+            QString _name;
+
+            //! kind
+            Kind _kind = Primitive;
+
+            //! element, cast to the enumeration matching kind
+            int _element = 0;
+
+            //! logical size
+            QSize _size;
+
+            //! option
+            QSharedPointer<QStyleOption> _option;
+
+            //! state added to all rendered states
+            QStyle::State _state = QStyle::State_None;
+
+            //! widget registered to the style animations, passed when rendering animated states
+            /** animated states are skipped for cases without widget */
+            QSharedPointer<QWidget> _widget;
+
+        };
+
+        //! rendered state
+        class State
+        {
+            public:
+
+            //! name
+            QString _name;
+
+            //! state
+            QStyle::State _state;
+
+            //! true if rendered half way through the hover animation
+            bool _animated = false;
+
+        };
+
+        //! all cases
+        static QVector<Case> cases( void );
+
+        //! all states
+        static QVector<State> states( void );
+
+        //! true if case can be rendered in given state
+        static bool accepts( const Case& current, const State& state )
+        { return !state._animated || current._widget; }
+
+        //! start hover animation for case widget, and freeze it half way
+        /** no event loop runs while rendering, so that the animation stays there */
+        static void startAnimation( QStyle*, const Case& );
+
+        //! render case once, with given state, using given painter
+        static void render( const QStyle*, const Case&, const State&, QPainter* );
+
+        private:
+
+        //! render case once, with given state and widget, using given painter
+        static void render( const QStyle*, const Case&, QStyle::State, const QWidget*, QPainter* );
+
+        //! style
+        QStyle* _style;
+
+        //! filter
+        QString _filter;
+
+        //! iterations
+        int _iterations = 200;
+
+        //! cold iterations
+        int _coldIterations = 20;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenprimitivebenchmarkmain.cpp
+// measure rendering time of individual style elements
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenpixeloracle.h"
+#include "oxygenprimitivebenchmark.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QScopedPointer>
+#include <QStyleFactory>
+
+//__________________________________________
+int main( int argc, char** argv )
+{
+
+    // no window is ever shown
+    if( !qEnvironmentVariableIsSet( "QT_QPA_PLATFORM" ) )
+    { qputenv( "QT_QPA_PLATFORM", "offscreen" ); }
+
+    QApplication app( argc, argv );
+    app.setApplicationName( QStringLiteral( "oxygen-primitive-benchmark" ) );
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption filterOption( QStringLiteral( "filter" ), QStringLiteral( "only run elements whose name contains text" ), QStringLiteral( "text" ) );
+    const QCommandLineOption iterationsOption( QStringLiteral( "iterations" ), QStringLiteral( "number of iterations with warm caches" ), QStringLiteral( "count" ), QStringLiteral( "200" ) );
+    const QCommandLineOption coldIterationsOption( QStringLiteral( "cold-iterations" ), QStringLiteral( "number of iterations with cold caches" ), QStringLiteral( "count" ), QStringLiteral( "20" ) );
+    const QCommandLineOption compareOption( QStringLiteral( "compare" ), QStringLiteral( "compare cached rendering against rendering with caches disabled instead of measuring time" ) );
+    const QCommandLineOption maxDeltaOption( QStringLiteral( "max-delta" ), QStringLiteral( "largest allowed channel delta, when comparing" ), QStringLiteral( "value" ), QStringLiteral( "8" ) );
+    const QCommandLineOption meanDeltaOption( QStringLiteral( "mean-delta" ), QStringLiteral( "largest allowed mean channel delta, when comparing" ), QStringLiteral( "value" ), QStringLiteral( "0.5" ) );
+    const QCommandLineOption toleranceOption( QStringLiteral( "tolerance" ), QStringLiteral( "allowed deltas for a given element, when comparing. Can be repeated" ), QStringLiteral( "element=max,mean" ) );
+    const QCommandLineOption dumpOption( QStringLiteral( "dump" ), QStringLiteral( "write images of failing comparisons to directory" ), QStringLiteral( "directory" ) );
+    parser.addOption( filterOption );
+    parser.addOption( iterationsOption );
+    parser.addOption( coldIterationsOption );
+    parser.addOption( compareOption );
+    parser.addOption( maxDeltaOption );
+    parser.addOption( meanDeltaOption );
+    parser.addOption( toleranceOption );
+    parser.addOption( dumpOption );
+    parser.process( app );
+
+    QScopedPointer<QStyle> style( QStyleFactory::create( QStringLiteral( "oxygen" ) ) );
+    if( !style )
+    {
+        QTextStream( stderr ) << "oxygen style is not available" << "\n";
+        return 1;
+    }
+
+    // elements are mostly rendered without widget, palette comes from the application
+    app.setPalette( style->standardPalette() );
+
+    QTextStream out( stdout );
+    if( parser.isSet( compareOption ) )
+    {
+
+        Oxygen::PixelOracle oracle( style.data() );
+        oracle.setFilter( parser.value( filterOption ) );
+        oracle.setDumpDirectory( parser.value( dumpOption ) );
+
+        Oxygen::PixelOracle::Tolerance tolerance;
+        tolerance._max = parser.value( maxDeltaOption ).toInt();
+        tolerance._mean = parser.value( meanDeltaOption ).toDouble();
+        oracle.setTolerance( tolerance );
+
+        for( const QString& value:parser.values( toleranceOption ) )
+        {
+            const int index( value.indexOf( QLatin1Char( '=' ) ) );
+            const QStringList deltas( value.mid( index + 1 ).split( QLatin1Char( ',' ) ) );
+            if( index <= 0 || deltas.size() != 2 )
+            {
+                QTextStream( stderr ) << "invalid tolerance " << value << "\n";
+                return 1;
+            }
+
+            Oxygen::PixelOracle::Tolerance elementTolerance;
+            elementTolerance._max = deltas[0].toInt();
+            elementTolerance._mean = deltas[1].toDouble();
+            oracle.setTolerance( value.left( index ), elementTolerance );
+        }
+
+        return oracle.run( out ) ? 0:1;
+
+    }
+
+    Oxygen::PrimitiveBenchmark benchmark( style.data() );
+    benchmark.setFilter( parser.value( filterOption ) );
+    benchmark.setIterations( parser.value( iterationsOption ).toInt() );
+    benchmark.setColdIterations( parser.value( coldIterationsOption ).toInt() );
+    benchmark.run( out );
+
+    return 0;
+
+}
@@ -47,6 +47,7 @@ namespace Oxygen
     //_______________________________________________________________________
     bool Simulator::_grabMouse = true;
     int Simulator::_defaultDelay = 250;
+    int Simulator::_fixedDelay = -1;
 
     //_______________________________________________________________________
     void Simulator::wait( int delay )
@@ -762,8 +763,15 @@ namespace Oxygen
     {
 
         // check value
-        if( delay == -1 ) delay = _defaultDelay;
-        if( delay <= 0 ) return;
+        if( _fixedDelay >= 0 ) delay = _fixedDelay;
+        else if( delay == -1 ) delay = _defaultDelay;
+
+        if( delay <= 0 )
+        {
+            // still deliver posted events, so that they are processed in order
+            if( _fixedDelay == 0 ) QCoreApplication::processEvents();
+            return;
+        }
 
         // this is largely inspired from qtestlib's qsleep implementation
         _timer.start( delay, this );
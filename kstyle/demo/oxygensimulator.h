@@ -100,6 +100,14 @@ namespace Oxygen
         static void setDefaultDelay( int value )
         { _defaultDelay = value; }
 
+        //* fixed delay
+        /**
+        when positive or null, it replaces all delays, including the built-in ones,
+        and pending events are flushed even when it is zero. Used for unattended benchmarks
+        */
+        static void setFixedDelay( int value )
+        { _fixedDelay = value; }
+
         Q_SIGNALS:
 
         //* emitted when simulator starts and stops
@@ -236,6 +244,9 @@ namespace Oxygen
         //* default delay
         static int _defaultDelay;
 
+        //* fixed delay
+        static int _fixedDelay;
+
     };
 
 }
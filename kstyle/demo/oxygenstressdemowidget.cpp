@@ -0,0 +1,508 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenstressdemowidget.cpp
+// generated demo pages modeling large applications
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenstressdemowidget.h"
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QFormLayout>
+#include <QHeaderView>
+#include <QIcon>
+#include <QLabel>
+#include <QLineEdit>
+#include <QMdiArea>
+#include <QMdiSubWindow>
+#include <QMenu>
+#include <QScrollArea>
+#include <QScrollBar>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QTabBar>
+#include <QTableView>
+#include <QTextEdit>
+#include <QToolBar>
+#include <QToolButton>
+#include <QTreeView>
+#include <QVBoxLayout>
+
+#include <KLocalizedString>
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //! icons cycled through by generated toolbar and menu items
+        const char* const iconNames[] =
+        {
+            "document-new",
+            "document-open",
+            "document-save",
+            "edit-copy",
+            "edit-paste",
+            "edit-find",
+            "go-previous",
+            "go-next",
+            "view-refresh",
+            "configure"
+        };
+
+        const int iconCount( sizeof( iconNames )/sizeof( iconNames[0] ) );
+
+        //! icon for a given index
+        QIcon icon( int index )
+        { return QIcon::fromTheme( QLatin1String( iconNames[index%iconCount] ) ); }
+
+    }
+
+    //______________________________________________________________
+    StressItemModel::StressItemModel( int rows, int children, int columns, QObject* parent ):
+        QAbstractItemModel( parent ),
+        _rows( rows ),
+        _children( children ),
+        _columns( columns )
+    {}
+
+    //______________________________________________________________
+    QModelIndex StressItemModel::index( int row, int column, const QModelIndex& parent ) const
+    {
+        if( row < 0 || column < 0 || row >= rowCount( parent ) || column >= _columns ) return QModelIndex();
+
+        // internal id is zero for top level items, and parent row + 1 for children
+        return createIndex( row, column, parent.isValid() ? quintptr( parent.row() + 1 ):0 );
+    }
+
+    //______________________________________________________________
+    QModelIndex StressItemModel::parent( const QModelIndex& index ) const
+    {
+        if( !( index.isValid() && index.internalId() ) ) return QModelIndex();
+        return createIndex( int( index.internalId() - 1 ), 0, quintptr( 0 ) );
+    }
+
+    //______________________________________________________________
+    int StressItemModel::rowCount( const QModelIndex& parent ) const
+    {
+        if( !parent.isValid() ) return _rows;
+        else if( parent.internalId() || parent.column() > 0 ) return 0;
+        else return _children;
+    }
+
+    //______________________________________________________________
+    int StressItemModel::columnCount( const QModelIndex& ) const
+    { return _columns; }
+
+    //______________________________________________________________
+    QVariant StressItemModel::data( const QModelIndex& index, int role ) const
+    {
+
+        if( !index.isValid() ) return QVariant();
+
+        const bool isChild( index.internalId() );
+        const int row( index.row() );
+        switch( role )
+        {
+
+            case Qt::DisplayRole:
+            if( index.column() > 0 ) return QString::number( ( row*31 + index.column()*17 )%1000 );
+            else if( isChild ) return i18n( "Item %1.%2", int( index.internalId() - 1 ), row );
+            else return i18n( "Item %1", row );
+
+            case Qt::DecorationRole:
+            if( index.column() == 0 ) return icon( row );
+            else return QVariant();
+
+            case Qt::CheckStateRole:
+            if( index.column() == 1 ) return ( row%3 ) ? Qt::Unchecked:Qt::Checked;
+            else return QVariant();
+
+            default: return QVariant();
+
+        }
+
+    }
+
+    //______________________________________________________________
+    QVariant StressItemModel::headerData( int section, Qt::Orientation orientation, int role ) const
+    {
+        if( role != Qt::DisplayRole ) return QVariant();
+        else if( orientation == Qt::Vertical ) return section + 1;
+        else if( section == 0 ) return i18n( "Name" );
+        else return i18n( "Value %1", section );
+    }
+
+    //______________________________________________________________
+    StressDemoWidget::StressDemoWidget( QWidget* parent ):
+        DemoWidget( parent )
+    {
+        setLayout( new QVBoxLayout() );
+        layout()->setContentsMargins( 0, 0, 0, 0 );
+    }
+
+    //______________________________________________________________
+    void StressDemoWidget::showEvent( QShowEvent* event )
+    {
+        if( !_initialized )
+        {
+            _initialized = true;
+            setupContents();
+        }
+
+        DemoWidget::showEvent( event );
+    }
+
+    //______________________________________________________________
+    void TreeStressDemoWidget::setupContents( void )
+    {
+
+        QSplitter* splitter( new QSplitter( Qt::Vertical, this ) );
+        layout()->addWidget( splitter );
+
+        // 1000 expanded top level items with 100 children each
+        _treeView = new QTreeView( splitter );
+        _treeView->setUniformRowHeights( true );
+        _treeView->setAlternatingRowColors( true );
+        _treeView->setModel( new StressItemModel( 1000, 100, 4, _treeView ) );
+        _treeView->expandAll();
+
+        // 100000 flat rows
+        _tableView = new QTableView( splitter );
+        _tableView->setModel( new StressItemModel( 100000, 0, 6, _tableView ) );
+        _tableView->verticalHeader()->setSectionResizeMode( QHeaderView::Fixed );
+
+    }
+
+    //______________________________________________________________
+    void TreeStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        const QList<QAbstractItemView*> views = { _treeView, _tableView };
+        for( QAbstractItemView* view : views )
+        {
+
+            for( int row = 0; row < 4; ++row )
+            { simulator().selectItem( view, row, row%2 ); }
+
+            QScrollBar* scrollBar( view->verticalScrollBar() );
+            simulator().slide( scrollBar, QPoint( 0, 50 ) );
+            simulator().slide( scrollBar, QPoint( 0, 50 ) );
+            simulator().slide( scrollBar, QPoint( 0, -100 ) );
+
+        }
+
+        simulator().run();
+
+    }
+
+    //______________________________________________________________
+    void TabStressDemoWidget::setupContents( void )
+    {
+
+        _tabBar = new QTabBar( this );
+        _tabBar->setTabsClosable( true );
+        _tabBar->setMovable( true );
+        _tabBar->setUsesScrollButtons( true );
+        for( int i = 0; i < 300; ++i )
+        { _tabBar->addTab( icon( i ), i18n( "Document %1", i + 1 ) ); }
+
+        layout()->addWidget( _tabBar );
+        static_cast<QVBoxLayout*>( layout() )->addStretch( 1 );
+
+    }
+
+    //______________________________________________________________
+    void TabStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        // select visible tabs, then scroll through the bar
+        for( int i = 0; i < 8; ++i )
+        { simulator().selectTab( _tabBar, i ); }
+
+        const auto buttons = _tabBar->findChildren<QToolButton*>();
+        for( QToolButton* button : buttons )
+        {
+            for( int i = 0; i < 10; ++i )
+            { simulator().click( button ); }
+        }
+
+        simulator().selectTab( _tabBar, 0 );
+        simulator().run();
+
+    }
+
+    //______________________________________________________________
+    void FormStressDemoWidget::setupContents( void )
+    {
+
+        _scrollArea = new QScrollArea( this );
+        _scrollArea->setWidgetResizable( true );
+        layout()->addWidget( _scrollArea );
+
+        // 1000 rows of label and field
+        QWidget* contents( new QWidget() );
+        QFormLayout* formLayout( new QFormLayout( contents ) );
+        for( int i = 0; i < 1000; ++i )
+        {
+
+            QWidget* field( nullptr );
+            switch( i%4 )
+            {
+                case 0: field = new QLineEdit( i18n( "Value %1", i ) ); break;
+                case 1:
+                {
+                    QComboBox* comboBox( new QComboBox() );
+                    comboBox->addItems( { i18n( "First" ), i18n( "Second" ), i18n( "Third" ) } );
+                    field = comboBox;
+                    break;
+                }
+
+                case 2:
+                {
+                    QSpinBox* spinBox( new QSpinBox() );
+                    spinBox->setValue( i%100 );
+                    field = spinBox;
+                    break;
+                }
+
+                case 3: default: field = new QCheckBox( i18n( "Enabled" ) ); break;
+            }
+
+            formLayout->addRow( i18n( "Field %1:", i + 1 ), field );
+            _fields.append( field );
+
+        }
+
+        _scrollArea->setWidget( contents );
+
+    }
+
+    //______________________________________________________________
+    void FormStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        // hover and edit the first fields, which are visible
+        for( int i = 0; i < 8; ++i )
+        {
+            QWidget* field( _fields[i] );
+            if( QLineEdit* lineEdit = qobject_cast<QLineEdit*>( field ) )
+            {
+
+                simulator().clearText( lineEdit );
+                simulator().writeText( lineEdit, i18n( "Text" ) );
+
+            } else if( QComboBox* comboBox = qobject_cast<QComboBox*>( field ) ) {
+
+                simulator().selectComboBoxItem( comboBox, 1 );
+
+            } else simulator().click( field );
+
+        }
+
+        // scroll through the form
+        QScrollBar* scrollBar( _scrollArea->verticalScrollBar() );
+        simulator().slide( scrollBar, QPoint( 0, 100 ) );
+        simulator().slide( scrollBar, QPoint( 0, 100 ) );
+        simulator().slide( scrollBar, QPoint( 0, -200 ) );
+
+        simulator().run();
+
+    }
+
+    //______________________________________________________________
+    void ScrollAreaStressDemoWidget::setupContents( void )
+    {
+
+        // each scroll area holds a label and the next scroll area
+        QWidget* parent( this );
+        for( int i = 0; i < 100; ++i )
+        {
+
+            QScrollArea* scrollArea( new QScrollArea() );
+            scrollArea->setWidgetResizable( true );
+            parent->layout()->addWidget( scrollArea );
+            _scrollAreas.append( scrollArea );
+
+            QWidget* contents( new QWidget() );
+            contents->setLayout( new QVBoxLayout() );
+            contents->layout()->setContentsMargins( 2, 2, 2, 2 );
+            contents->layout()->setSpacing( 2 );
+            contents->layout()->addWidget( new QLabel( i18n( "Level %1", i + 1 ) ) );
+            scrollArea->setWidget( contents );
+
+            parent = contents;
+
+        }
+
+        QTextEdit* textEdit( new QTextEdit() );
+        textEdit->setPlainText( i18n( "Innermost scroll area" ) );
+        textEdit->setMinimumSize( 200, 150 );
+        parent->layout()->addWidget( textEdit );
+
+    }
+
+    //______________________________________________________________
+    void ScrollAreaStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        // scroll areas get squeezed by their parents, and only some show scrollbars
+        for( QScrollArea* scrollArea : std::as_const( _scrollAreas ) )
+        {
+            if( scrollArea->verticalScrollBar()->isVisible() )
+            {
+                simulator().slide( scrollArea->verticalScrollBar(), QPoint( 0, 50 ) );
+                simulator().slide( scrollArea->verticalScrollBar(), QPoint( 0, -50 ) );
+            }
+
+            if( scrollArea->horizontalScrollBar()->isVisible() )
+            {
+                simulator().slide( scrollArea->horizontalScrollBar(), QPoint( 50, 0 ) );
+                simulator().slide( scrollArea->horizontalScrollBar(), QPoint( -50, 0 ) );
+            }
+        }
+
+        simulator().run();
+
+    }
+
+    //______________________________________________________________
+    void MdiStressDemoWidget::setupContents( void )
+    {
+
+        _mdiArea = new QMdiArea( this );
+        layout()->addWidget( _mdiArea );
+
+        for( int i = 0; i < 50; ++i )
+        {
+            QTextEdit* textEdit( new QTextEdit() );
+            textEdit->setPlainText( i18n( "Document %1", i + 1 ) );
+            QMdiSubWindow* window( _mdiArea->addSubWindow( textEdit ) );
+            window->setWindowTitle( i18n( "Document %1", i + 1 ) );
+            window->setWindowIcon( icon( i ) );
+            window->resize( 240, 160 );
+            window->show();
+        }
+
+        _mdiArea->cascadeSubWindows();
+
+    }
+
+    //______________________________________________________________
+    void MdiStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        // activate and move windows, from the topmost down
+        const auto windows( _mdiArea->subWindowList( QMdiArea::StackingOrder ) );
+        for( int i = windows.size() - 1; i >= 0 && i >= windows.size() - 10; --i )
+        {
+            QMdiSubWindow* window( windows[i] );
+            simulator().click( window );
+            simulator().slide( window, QPoint( 20, 20 ) );
+            simulator().slide( window, QPoint( -20, -20 ) );
+        }
+
+        simulator().run();
+
+    }
+
+    //______________________________________________________________
+    void ToolBarStressDemoWidget::setupContents( void )
+    {
+
+        _toolBar = new QToolBar( this );
+        _toolBar->setToolButtonStyle( Qt::ToolButtonTextBesideIcon );
+        for( int i = 0; i < 200; ++i )
+        {
+            QAction* action( _toolBar->addAction( icon( i ), i18n( "Action %1", i + 1 ) ) );
+            action->setCheckable( i%5 == 0 );
+            if( i%20 == 19 ) _toolBar->addSeparator();
+        }
+
+        layout()->addWidget( _toolBar );
+        static_cast<QVBoxLayout*>( layout() )->addStretch( 1 );
+
+    }
+
+    //______________________________________________________________
+    void ToolBarStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        // visible buttons, including the extension button that shows the overflow
+        const auto buttons = _toolBar->findChildren<QToolButton*>();
+        for( QToolButton* button : buttons )
+        {
+            if( button->isVisible() )
+            { simulator().click( button ); }
+        }
+
+        simulator().run();
+
+    }
+
+    //______________________________________________________________
+    void MenuStressDemoWidget::setupContents( void )
+    {
+
+        QMenu* menu( new QMenu( this ) );
+        QMenu* subMenu( nullptr );
+        for( int i = 0; i < 500; ++i )
+        {
+
+            // a section header and submenu every 50 items
+            if( i%50 == 0 )
+            {
+                menu->addSection( i18n( "Section %1", i/50 + 1 ) );
+                subMenu = menu->addMenu( icon( i ), i18n( "Submenu %1", i/50 + 1 ) );
+            }
+
+            QAction* action( menu->addAction( icon( i ), i18n( "Menu item %1", i + 1 ) ) );
+            action->setShortcut( QKeySequence( Qt::CTRL | Qt::Key( Qt::Key_A + i%26 ) ) );
+            action->setCheckable( i%7 == 0 );
+            subMenu->addAction( i18n( "Submenu item %1", i + 1 ) );
+
+        }
+
+        _button = new QToolButton( this );
+        _button->setText( i18n( "Menu" ) );
+        _button->setToolButtonStyle( Qt::ToolButtonTextBesideIcon );
+        _button->setPopupMode( QToolButton::InstantPopup );
+        _button->setMenu( menu );
+
+        layout()->addWidget( _button );
+        static_cast<QVBoxLayout*>( layout() )->addStretch( 1 );
+
+    }
+
+    //______________________________________________________________
+    void MenuStressDemoWidget::benchmark( void )
+    {
+        if( !isVisible() ) return;
+
+        // each selection opens, lays out and paints the whole menu
+        const auto actions = _button->menu()->actions();
+        int count( 0 );
+        for( int i = 0; i < actions.size() && count < 5; ++i )
+        {
+            QAction* action( actions[i] );
+            if( action->isSeparator() || action->menu() ) continue;
+            simulator().selectMenuItem( _button, i );
+            ++count;
+        }
+
+        simulator().run();
+
+    }
+
+}
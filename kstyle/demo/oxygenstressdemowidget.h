@@ -0,0 +1,315 @@
+#ifndef oxygenstressdemowidget_h
+#define oxygenstressdemowidget_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenstressdemowidget.h
+// generated demo pages modeling large applications
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygendemowidget.h"
+
+#include <QAbstractItemModel>
+#include <QVector>
+#include <QWidget>
+
+class QMdiArea;
+class QScrollArea;
+class QTabBar;
+class QTableView;
+class QToolBar;
+class QToolButton;
+class QTreeView;
+
+namespace Oxygen
+{
+
+    //! item model generating its data on request, so that very large views are cheap to set up
+    class StressItemModel: public QAbstractItemModel
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor. Top level rows each get given number of children
+        explicit StressItemModel( int rows, int children, int columns, QObject* = nullptr );
+
+        //!@name model interface
+        //@{
+
+        QModelIndex index( int, int, const QModelIndex& = QModelIndex() ) const override;
+        QModelIndex parent( const QModelIndex& ) const override;
+        int rowCount( const QModelIndex& = QModelIndex() ) const override;
+        int columnCount( const QModelIndex& = QModelIndex() ) const override;
+        QVariant data( const QModelIndex&, int = Qt::DisplayRole ) const override;
+        QVariant headerData( int, Qt::Orientation, int = Qt::DisplayRole ) const override;
+
+        //@}
+
+        private:
+
+        //! top level rows
+        int _rows = 0;
+
+        //! children per top level row
+        int _children = 0;
+
+        //! columns
+        int _columns = 0;
+
+    };
+
+    //! base class for stress pages
+    /*!
+    contents are only created the first time the page is shown,
+    so that the stress pages do not slow down the demo startup
+    */
+    class StressDemoWidget: public DemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit StressDemoWidget( QWidget* = nullptr );
+
+        protected:
+
+        //! show event
+        void showEvent( QShowEvent* ) override;
+
+        //! create contents
+        virtual void setupContents( void ) = 0;
+
+        private:
+
+        //! true when contents are created
+        bool _initialized = false;
+
+    };
+
+    //! 100k rows tree and table
+    class TreeStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit TreeStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! tree
+        QTreeView* _treeView = nullptr;
+
+        //! table
+        QTableView* _tableView = nullptr;
+
+    };
+
+    //! tab bar with 300 tabs
+    class TabStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit TabStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! tab bar
+        QTabBar* _tabBar = nullptr;
+
+    };
+
+    //! form with 2000 widgets
+    class FormStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit FormStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! scroll area
+        QScrollArea* _scrollArea = nullptr;
+
+        //! fields
+        QVector<QWidget*> _fields;
+
+    };
+
+    //! 100 nested scroll areas
+    class ScrollAreaStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit ScrollAreaStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! scroll areas, outermost first
+        QVector<QScrollArea*> _scrollAreas;
+
+    };
+
+    //! 50 MDI subwindows
+    class MdiStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit MdiStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! mdi area
+        QMdiArea* _mdiArea = nullptr;
+
+    };
+
+    //! toolbar with 200 buttons
+    class ToolBarStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit ToolBarStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! toolbar
+        QToolBar* _toolBar = nullptr;
+
+    };
+
+    //! menu with 500 items
+    class MenuStressDemoWidget: public StressDemoWidget
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //! constructor
+        explicit MenuStressDemoWidget( QWidget* parent = nullptr ):
+            StressDemoWidget( parent )
+        {}
+
+        public Q_SLOTS:
+
+        //! benchmark
+        void benchmark( void );
+
+        protected:
+
+        //! create contents
+        void setupContents( void ) override;
+
+        private:
+
+        //! button holding the menu
+        QToolButton* _button = nullptr;
+
+    };
+
+}
+
+#endif
@@ -12,6 +12,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenblurhelper.h"
+#include "oxygeneventdispatcher.h"
 
 #include "oxygenstyleconfigdata.h"
 
@@ -54,8 +55,8 @@ namespace Oxygen
         // check if already registered
         if( _widgets.contains( widget ) ) return;
 
-        // install event filter
-        addEventFilter( widget );
+        // subscribe to events
+        EventDispatcher::instance().subscribe( widget, this, { QEvent::Hide, QEvent::Move, QEvent::Show, QEvent::Resize } );
 
         // add to widgets list
         _widgets.insert( widget );
@@ -65,9 +66,14 @@ namespace Oxygen
 
         if( enabled() )
         {
-            // schedule shadow area repaint
-            _pendingWidgets.insert( widget, widget );
-            update();
+
+            // update windows right away, so that their first frame is blurred
+            if( widget->isWindow() ) immediateUpdate( widget );
+            else {
+                _pendingWidgets.insert( widget, widget );
+                delayedUpdate();
+            }
+
         }
 
     }
@@ -78,8 +84,12 @@ namespace Oxygen
         // remove from widgets
         if( !_widgets.remove( widget ) ) return;
 
-        // remove event filter
-        widget->removeEventFilter( this );
+        // unsubscribe from events
+        EventDispatcher::instance().unsubscribe( widget, this );
+
+        // discard pending update and last sent regions
+        _pendingWidgets.remove( widget );
+        _sentRegions.remove( widget );
 
         if( isTransparent( widget ) ) clear( widget );
     }
@@ -95,13 +105,14 @@ namespace Oxygen
         {
 
             case QEvent::Hide:
+            case QEvent::Move:
             {
                 QWidget* widget( qobject_cast<QWidget*>( object ) );
                 if( widget && isOpaque( widget ) && isTransparent( widget->window() ) )
                 {
                     QWidget* window( widget->window() );
                     _pendingWidgets.insert( window, window );
-                    update();
+                    delayedUpdate();
                 }
                 break;
 
@@ -117,8 +128,13 @@ namespace Oxygen
                 if( isTransparent( widget ) )
                 {
 
-                    _pendingWidgets.insert( widget, widget );
-                    update();
+                    // windows are updated before being mapped, so that their first frame is blurred.
+                    // Later resizes are coalesced
+                    if( event->type() == QEvent::Show && widget->isWindow() ) immediateUpdate( widget );
+                    else {
+                        _pendingWidgets.insert( widget, widget );
+                        delayedUpdate();
+                    }
 
                 } else if( isOpaque( widget ) ) {
 
@@ -126,7 +142,7 @@ namespace Oxygen
                     if( isTransparent( window ) )
                     {
                         _pendingWidgets.insert( window, window );
-                        update();
+                        delayedUpdate();
                     }
 
                 }
@@ -201,49 +217,108 @@ namespace Oxygen
     }
 
     //___________________________________________________________
-    void BlurHelper::update( QWidget* widget ) const
+    void BlurHelper::update( void )
     {
 
+        // take pending widgets first, in case updates trigger new events
+        const WidgetSet pendingWidgets( _pendingWidgets );
+        _pendingWidgets.clear();
+
+        bool changed( false );
+        for ( const WidgetPointer &widget : pendingWidgets )
+        { if( widget && update( widget.data() ) ) changed = true; }
+
         #if OXYGEN_HAVE_X11
-        if( !_helper.isX11() ) return;
+        if( changed ) xcb_flush( _helper.connection() );
+        #else
+        Q_UNUSED( changed )
+        #endif
+
+    }
+
+    //___________________________________________________________
+    void BlurHelper::immediateUpdate( QWidget* widget )
+    {
+
+        // a pending update would be redundant
+        _pendingWidgets.remove( widget );
+
+        #if OXYGEN_HAVE_X11
+        if( update( widget ) ) xcb_flush( _helper.connection() );
+        #else
+        update( widget );
+        #endif
+
+    }
+
+    //___________________________________________________________
+    bool BlurHelper::update( QWidget* widget )
+    {
+
+        #if OXYGEN_HAVE_X11
+        if( !_helper.isX11() ) return false;
 
         /*
         directly from bespin code. Supposibly prevent playing with some 'pseudo-widgets'
         that have winId matching some other -random- window
         */
         if( !(widget->testAttribute(Qt::WA_WState_Created) || widget->internalWinId() ))
-        { return; }
+        { return false; }
+
+        // previously sent regions, discarded if the native window changed
+        const WId windowId( widget->winId() );
+        Regions sent( _sentRegions.value( widget ) );
+        const bool hasSent( _sentRegions.contains( widget ) && sent._windowId == windowId );
 
+        bool changed( false );
         const QRegion blurRegion( this->blurRegion( widget ) );
-        const QRegion opaqueRegion = QRegion(0, 0, widget->width(), widget->height()) - blurRegion;
         if( blurRegion.isEmpty() ) {
 
-            clear( widget );
+            if( hasSent )
+            {
+                clear( widget );
+                changed = true;
+            }
 
         } else {
 
-            QVector<quint32> data;
-            for ( const QRect &rect : blurRegion )
-            { data << rect.x() << rect.y() << rect.width() << rect.height(); }
+            const QRegion opaqueRegion = QRegion(0, 0, widget->width(), widget->height()) - blurRegion;
 
-            xcb_change_property( _helper.connection(), XCB_PROP_MODE_REPLACE, widget->winId(), _blurAtom, XCB_ATOM_CARDINAL, 32, data.size(), data.constData() );
+            Regions regions;
+            regions._windowId = windowId;
+            for ( const QRect &rect : blurRegion )
+            { regions._blur << rect.x() << rect.y() << rect.width() << rect.height(); }
 
-            data.clear();
             for ( const QRect &rect : opaqueRegion )
-            { data << rect.x() << rect.y() << rect.width() << rect.height(); }
+            { regions._opaque << rect.x() << rect.y() << rect.width() << rect.height(); }
+
+            // only send what differs from the last values
+            if( !hasSent || regions._blur != sent._blur )
+            {
+                xcb_change_property( _helper.connection(), XCB_PROP_MODE_REPLACE, windowId, _blurAtom, XCB_ATOM_CARDINAL, 32, regions._blur.size(), regions._blur.constData() );
+                changed = true;
+            }
+
+            if( !hasSent || regions._opaque != sent._opaque )
+            {
+                xcb_change_property( _helper.connection(), XCB_PROP_MODE_REPLACE, windowId, _opaqueAtom, XCB_ATOM_CARDINAL, 32, regions._opaque.size(), regions._opaque.constData() );
+                changed = true;
+            }
 
-            xcb_change_property( _helper.connection(), XCB_PROP_MODE_REPLACE, widget->winId(), _opaqueAtom, XCB_ATOM_CARDINAL, 32, data.size(), data.constData() );
-            xcb_flush( _helper.connection() );
+            _sentRegions.insert( widget, regions );
 
         }
 
         // force update
-        if( widget->isVisible() )
+        if( changed && widget->isVisible() )
         { widget->update(); }
 
+        return changed;
+
         #else
 
         Q_UNUSED( widget )
+        return false;
 
         #endif
 
@@ -251,8 +326,10 @@ namespace Oxygen
 
 
     //___________________________________________________________
-    void BlurHelper::clear( QWidget* widget ) const
+    void BlurHelper::clear( QWidget* widget )
     {
+        _sentRegions.remove( widget );
+
         #if OXYGEN_HAVE_X11
         if( !_helper.isX11() ) return;
 
@@ -22,6 +22,7 @@
 #include <QObject>
 #include <QSet>
 #include <QTimerEvent>
+#include <QVector>
 
 #include <QDockWidget>
 #include <QMenu>
@@ -80,39 +81,37 @@ namespace Oxygen
 
         //* wiget destroyed
         void widgetDestroyed( QObject* object )
-        { _widgets.remove( object ); }
-
-        private:
-
-        //* install event filter to object, in a unique way
-        void addEventFilter( QObject* object )
         {
-            object->removeEventFilter( this );
-            object->installEventFilter( this );
+            _widgets.remove( object );
+            _sentRegions.remove( object );
         }
 
+        private:
+
         //* get list of blur-behind regions matching a given widget
         QRegion blurRegion( QWidget* ) const;
 
         //* trim blur region to remove unnecessary areas (recursive)
         void trimBlurRegion( QWidget*, QWidget*, QRegion& ) const;
 
-        //* update blur region for all pending widgets
-        void update( void )
-        {
-
-            for ( const WidgetPointer &widget : std::as_const(_pendingWidgets) )
-            { if( widget ) update( widget.data() ); }
+        //* schedule update of pending widgets at next event loop iteration
+        void delayedUpdate( void )
+        { if( !_timer.isActive() ) _timer.start( 0, this ); }
 
-            _pendingWidgets.clear();
-
-        }
+        //* update blur region for all pending widgets
+        /** X server connection is flushed once, if anything changed */
+        void update( void );
 
         //* update blur regions for given widget
-        void update( QWidget* ) const;
+        /** returns true if window properties were changed */
+        bool update( QWidget* );
+
+        //* update blur regions for given widget right away, and flush X server connection if needed
+        /** used for top level windows on registration and show, so that their first frame is already blurred */
+        void immediateUpdate( QWidget* );
 
         //* clear blur regions for given widget
-        void clear( QWidget* ) const;
+        void clear( QWidget* );
 
         //* returns true if a given widget is opaque
         bool isOpaque( const QWidget* widget ) const;
@@ -139,6 +138,25 @@ namespace Oxygen
         //* delayed update timer
         QBasicTimer _timer;
 
+        //* regions last sent to the window manager
+        class Regions
+        {
+            public:
+
+            //* window id
+            WId _windowId = 0;
+
+            //* blur region rects
+            QVector<quint32> _blur;
+
+            //* opaque region rects
+            QVector<quint32> _opaque;
+
+        };
+
+        //* regions last sent, per window
+        QHash<const QObject*, Regions> _sentRegions;
+
         #if OXYGEN_HAVE_X11
         //* blur atom
         xcb_atom_t _blurAtom;
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygeneventdispatcher.cpp
+// single event filter per widget, forwarding events to subscribers by type
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygeneventdispatcher.h"
+
+#include <QCoreApplication>
+
+namespace Oxygen
+{
+
+    //____________________________________________________________
+    EventDispatcher::EventTypes::EventTypes( std::initializer_list<QEvent::Type> types )
+    {
+        for( QEvent::Type type:types )
+        {
+            Q_ASSERT( int( type ) < MaxType );
+            if( int( type ) < MaxType ) _types.set( type );
+        }
+    }
+
+    //____________________________________________________________
+    EventDispatcher::EventTypes EventDispatcher::EventTypes::all( void )
+    {
+        EventTypes out;
+        out._all = true;
+        return out;
+    }
+
+    //____________________________________________________________
+    void EventDispatcher::Subscriptions::prune( void )
+    {
+        _types = EventTypes();
+        for( auto iter = _subscriptions.begin(); iter != _subscriptions.end(); )
+        {
+            if( !iter->_subscriber ) iter = _subscriptions.erase( iter );
+            else {
+                _types |= iter->_types;
+                ++iter;
+            }
+        }
+    }
+
+    //____________________________________________________________
+    EventDispatcher& EventDispatcher::instance( void )
+    {
+        // parent to the application, so that it outlives style components
+        static QPointer<EventDispatcher> dispatcher;
+        if( !dispatcher ) dispatcher = new EventDispatcher( QCoreApplication::instance() );
+        return *dispatcher;
+    }
+
+    //____________________________________________________________
+    EventDispatcher::EventDispatcher( QObject* parent ):
+        QObject( parent )
+    {}
+
+    //____________________________________________________________
+    void EventDispatcher::subscribe( QObject* object, QObject* subscriber, const EventTypes& types )
+    {
+
+        if( !( object && subscriber ) ) return;
+
+        auto iter( _objects.find( object ) );
+        if( iter == _objects.end() )
+        {
+            iter = _objects.insert( object, Subscriptions() );
+            connect( object, SIGNAL(destroyed(QObject*)), SLOT(unregisterObject(QObject*)) );
+        }
+
+        // (re)install event filter, so that it is moved in front of filters installed
+        // by the application since the last subscription, as individual filters used to be
+        object->removeEventFilter( this );
+        object->installEventFilter( this );
+
+        // remove existing subscription, and prepend
+        Subscriptions& subscriptions( iter.value() );
+        for( int i = 0; i < subscriptions._subscriptions.size(); ++i )
+        {
+            if( subscriptions._subscriptions[i]._subscriber.data() != subscriber ) continue;
+            subscriptions._subscriptions.remove( i );
+            break;
+        }
+
+        subscriptions._subscriptions.prepend( Subscription( subscriber, types ) );
+        subscriptions.prune();
+
+    }
+
+    //____________________________________________________________
+    void EventDispatcher::unsubscribe( QObject* object, QObject* subscriber )
+    {
+
+        auto iter( _objects.find( object ) );
+        if( iter == _objects.end() ) return;
+
+        Subscriptions& subscriptions( iter.value() );
+        for( auto& subscription:subscriptions._subscriptions )
+        { if( subscription._subscriber.data() == subscriber ) subscription._subscriber.clear(); }
+
+        subscriptions.prune();
+        if( subscriptions._subscriptions.isEmpty() ) remove( object );
+
+    }
+
+    //____________________________________________________________
+    bool EventDispatcher::isSubscribed( const QObject* object, const QObject* subscriber ) const
+    {
+        auto iter( _objects.constFind( object ) );
+        if( iter == _objects.constEnd() ) return false;
+
+        for( const auto& subscription:iter.value()._subscriptions )
+        { if( subscription._subscriber.data() == subscriber ) return true; }
+
+        return false;
+    }
+
+    //____________________________________________________________
+    bool EventDispatcher::eventFilter( QObject* object, QEvent* event )
+    {
+
+        auto iter( _objects.constFind( object ) );
+        if( iter == _objects.constEnd() || !iter.value()._types.contains( event->type() ) ) return false;
+
+        // copy subscriptions, since subscribers may subscribe or unsubscribe while handling the event
+        bool pruneNeeded( false );
+        const QVector<Subscription> subscriptions( iter.value()._subscriptions );
+        for( const auto& subscription:subscriptions )
+        {
+            if( !subscription._subscriber ) pruneNeeded = true;
+            else if( subscription._types.contains( event->type() ) && subscription._subscriber.data()->eventFilter( object, event ) ) return true;
+        }
+
+        // drop subscribers that were deleted
+        if( pruneNeeded )
+        {
+            auto current( _objects.find( object ) );
+            if( current != _objects.end() )
+            {
+                current.value().prune();
+                if( current.value()._subscriptions.isEmpty() ) remove( object );
+            }
+        }
+
+        return false;
+
+    }
+
+    //____________________________________________________________
+    void EventDispatcher::unregisterObject( QObject* object )
+    { _objects.remove( object ); }
+
+    //____________________________________________________________
+    void EventDispatcher::remove( QObject* object )
+    {
+        _objects.remove( object );
+        object->removeEventFilter( this );
+        disconnect( object, SIGNAL(destroyed(QObject*)), this, SLOT(unregisterObject(QObject*)) );
+    }
+
+}
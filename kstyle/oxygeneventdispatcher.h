@@ -0,0 +1,157 @@
+#ifndef oxygeneventdispatcher_h
+#define oxygeneventdispatcher_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygeneventdispatcher.h
+// single event filter per widget, forwarding events to subscribers by type
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygen.h"
+
+#include <QEvent>
+#include <QHash>
+#include <QObject>
+#include <QVector>
+
+#include <bitset>
+#include <initializer_list>
+
+namespace Oxygen
+{
+
+    //* single event filter per widget, forwarding events to subscribers by type
+    /**
+    instead of installing their own event filter, style components subscribe to a given object
+    with the list of event types they handle. The dispatcher filters the object on their behalf,
+    rejects events nobody asked for with a single bit test, and calls the eventFilter method
+    of matching subscribers only, most recent subscription first, as Qt does for event filters.
+    Returning true from a subscriber eventFilter stops the event, as usual
+    */
+    class EventDispatcher: public QObject
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //* event types a subscriber handles
+        class EventTypes
+        {
+
+            public:
+
+            //* constructor
+            EventTypes( std::initializer_list<QEvent::Type> = {} );
+
+            //* all events
+            static EventTypes all( void );
+
+            //* true if type is included
+            bool contains( QEvent::Type type ) const
+            { return _all || ( int( type ) < MaxType && _types.test( type ) ); }
+
+            //* merge
+            EventTypes& operator |= ( const EventTypes& other )
+            {
+                _all |= other._all;
+                _types |= other._types;
+                return *this;
+            }
+
+            private:
+
+            //* event types past this value are only delivered to subscribers to all events
+            enum { MaxType = 512 };
+
+            //* types
+            std::bitset<MaxType> _types;
+
+            //* all events
+            bool _all = false;
+
+        };
+
+        //* shared dispatcher
+        static EventDispatcher& instance( void );
+
+        //* subscribe to events of given types sent to object
+        /**
+        subscribing again moves the subscription in front, and replaces its event types.
+        The dispatcher event filter is also reinstalled, which moves it in front of other event filters on the object
+        */
+        void subscribe( QObject* object, QObject* subscriber, const EventTypes& );
+
+        //* unsubscribe from events sent to object
+        void unsubscribe( QObject* object, QObject* subscriber );
+
+        //* true if subscriber is subscribed to object
+        bool isSubscribed( const QObject* object, const QObject* subscriber ) const;
+
+        //* number of objects with at least one subscription
+        int size( void ) const
+        { return _objects.size(); }
+
+        //* event filter
+        bool eventFilter( QObject*, QEvent* ) override;
+
+        protected Q_SLOTS:
+
+        //* unregister object
+        void unregisterObject( QObject* );
+
+        private:
+
+        //* constructor
+        explicit EventDispatcher( QObject* );
+
+        //* subscription
+        class Subscription
+        {
+            public:
+
+            //* constructor
+            Subscription( QObject* subscriber = nullptr, const EventTypes& types = EventTypes::all() ):
+                _subscriber( subscriber ),
+                _types( types )
+            {}
+
+            //* subscriber
+            WeakPointer<QObject> _subscriber;
+
+            //* event types
+            EventTypes _types;
+
+        };
+
+        //* subscriptions of a given object
+        class Subscriptions
+        {
+            public:
+
+            //* subscriptions, most recent first
+            QVector<Subscription> _subscriptions;
+
+            //* union of subscribed event types
+            EventTypes _types;
+
+            //* remove subscriptions whose subscriber is gone, and update event types
+            void prune( void );
+
+        };
+
+        //* remove object entry and event filter
+        void remove( QObject* );
+
+        //* subscriptions, per object
+        QHash<const QObject*, Subscriptions> _objects;
+
+    };
+
+}
+
+#endif
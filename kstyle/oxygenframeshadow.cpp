@@ -12,6 +12,8 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenframeshadow.h"
+#include "oxygeneventdispatcher.h"
+#include "oxygenwidgettraits.h"
 
 #include <QDebug>
 #include <QAbstractScrollArea>
@@ -37,20 +39,20 @@ namespace Oxygen
         bool accepted = false;
         bool flat = false;
 
-        // cast to frame and check
-        QFrame* frame( qobject_cast<QFrame*>( widget ) );
-        if( frame )
+        // check frame
+        const WidgetTraits traits( WidgetTraits::get( widget ) );
+        if( traits.is( WidgetTraits::Frame ) )
         {
             // also do not install on QSplitter
             /*
             due to Qt, splitters are set with a frame style that matches the condition below,
             though no shadow should be installed, obviously
             */
-            if( qobject_cast<QSplitter*>( widget ) ) return false;
+            if( traits.is( WidgetTraits::Splitter ) ) return false;
 
             // further checks on frame shape, and parent
-            if( frame->frameStyle() == (QFrame::StyledPanel | QFrame::Sunken) ) accepted = true;
-            else if( widget->parent() && widget->parent()->inherits( "QComboBoxPrivateContainer" ) )
+            if( static_cast<QFrame*>( widget )->frameStyle() == (QFrame::StyledPanel | QFrame::Sunken) ) accepted = true;
+            else if( WidgetTraits::get( widget->parent() ).is( WidgetTraits::ComboBoxPrivateContainer ) )
             {
 
                 accepted = true;
@@ -58,7 +60,7 @@ namespace Oxygen
 
             }
 
-        } else if( widget->inherits( "KTextEditor::View" ) ) accepted = true;
+        } else if( traits.is( WidgetTraits::KTextEditorView ) ) accepted = true;
 
         if( !accepted ) return false;
 
@@ -66,13 +68,10 @@ namespace Oxygen
         QWidget* parent( widget->parentWidget() );
         while( parent && !parent->isTopLevel() )
         {
-            if( parent->inherits( "KHTMLView" ) ) return false;
+            if( WidgetTraits::get( parent ).is( WidgetTraits::KHTMLView ) ) return false;
             parent = parent->parentWidget();
         }
 
-        // store in set
-        _registeredWidgets.insert( widget );
-
         // catch object destruction
         connect( widget, SIGNAL(destroyed(QObject*)), SLOT(widgetDestroyed(QObject*)) );
 
@@ -87,8 +86,8 @@ namespace Oxygen
     void FrameShadowFactory::unregisterWidget( QWidget* widget )
     {
         if( !isRegistered( widget ) ) return;
-        _registeredWidgets.remove( widget );
         removeShadows( widget );
+        _shadows.remove( widget );
     }
 
     //____________________________________________________________________________________
@@ -121,42 +120,44 @@ namespace Oxygen
 
     }
 
+    //____________________________________________________________________________________
+    FrameShadowBase* FrameShadowFactory::shadow( const QObject* object ) const
+    { return _shadows.value( object ).data(); }
+
     //____________________________________________________________________________________
     void FrameShadowFactory::installShadows( QWidget* widget, StyleHelper& helper, bool flat )
     {
 
         removeShadows(widget);
 
-        widget->installEventFilter(this);
+        EventDispatcher::instance().subscribe( widget, this, { QEvent::ZOrderChange, QEvent::Show, QEvent::Resize } );
 
+        // block ChildAdded events while the shadow is created
         widget->installEventFilter( &_addEventFilter );
-        if( !flat )
-        {
-            installShadow( widget, helper, ShadowAreaLeft );
-            installShadow( widget, helper, ShadowAreaRight );
-        }
 
-        installShadow( widget, helper, ShadowAreaTop, flat );
-        installShadow( widget, helper, ShadowAreaBottom, flat );
+        FrameShadowBase *shadow(0);
+        if( flat ) shadow = new FlatFrameShadow( helper );
+        else shadow = new SunkenFrameShadow( helper );
+        shadow->setParent(widget);
+        shadow->hide();
+
         widget->removeEventFilter( &_addEventFilter );
 
+        _shadows.insert( widget, shadow );
+
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::removeShadows( QWidget* widget )
     {
 
-        widget->removeEventFilter( this );
+        EventDispatcher::instance().unsubscribe( widget, this );
 
-        const QList<QObject* > children = widget->children();
-        for ( QObject *child : children )
+        if( FrameShadowBase* shadow = this->shadow( widget ) )
         {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase*>(child) )
-            {
-                shadow->hide();
-                shadow->setParent(0);
-                shadow->deleteLater();
-            }
+            shadow->hide();
+            shadow->setParent(0);
+            shadow->deleteLater();
         }
 
     }
@@ -164,94 +165,48 @@ namespace Oxygen
     //____________________________________________________________________________________
     void FrameShadowFactory::updateShadowsGeometry( QObject* object ) const
     {
-
-        const QList<QObject *> children = object->children();
-        for ( QObject *child : children )
-        {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase *>(child) )
-            { shadow->updateGeometry(); }
-        }
-
+        if( FrameShadowBase* shadow = this->shadow( object ) )
+        { shadow->updateGeometry(); }
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::updateShadowsGeometry( const QObject* object, QRect rect ) const
     {
-
-        const QList<QObject *> children = object->children();
-        for ( QObject *child : children )
-        {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase *>(child) )
-            { shadow->updateGeometry( rect ); }
-        }
-
+        if( FrameShadowBase* shadow = this->shadow( object ) )
+        { shadow->updateGeometry( rect ); }
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::raiseShadows( QObject* object ) const
     {
-
-        const QList<QObject *> children = object->children();
-        for ( QObject *child : children )
-        {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase *>(child) )
-            { shadow->raise(); }
-        }
-
+        if( FrameShadowBase* shadow = this->shadow( object ) )
+        { shadow->raise(); }
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::update( QObject* object ) const
     {
-
-        const QList<QObject* > children = object->children();
-        for ( QObject *child : children )
-        {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase *>(child) )
-            { shadow->update();}
-        }
-
+        if( FrameShadowBase* shadow = this->shadow( object ) )
+        { shadow->update(); }
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::setHasContrast( const QWidget* widget, bool value ) const
     {
-
-        const QList<QObject *> children = widget->children();
-        for ( QObject *child : children )
-        {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase *>(child) )
-            { shadow->setHasContrast( value ); }
-        }
-
+        if( FrameShadowBase* shadow = this->shadow( widget ) )
+        { shadow->setHasContrast( value ); }
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::updateState( const QWidget* widget, bool focus, bool hover, qreal opacity, AnimationMode mode ) const
     {
-
-        const QList<QObject *> children = widget->children();
-        for ( QObject *child : children )
-        {
-            if( FrameShadowBase* shadow = qobject_cast<FrameShadowBase *>(child) )
-            { shadow->updateState( focus, hover, opacity, mode ); }
-        }
-
-    }
-
-    //____________________________________________________________________________________
-    void FrameShadowFactory::installShadow( QWidget* widget, StyleHelper& helper, ShadowArea area, bool flat ) const
-    {
-        FrameShadowBase *shadow(0);
-        if( flat ) shadow = new FlatFrameShadow( area, helper );
-        else shadow = new SunkenFrameShadow( area, helper );
-        shadow->setParent(widget);
-        shadow->hide();
+        if( FrameShadowBase* shadow = this->shadow( widget ) )
+        { shadow->updateState( focus, hover, opacity, mode ); }
     }
 
     //____________________________________________________________________________________
     void FrameShadowFactory::widgetDestroyed( QObject* object )
-    { _registeredWidgets.remove( object ); }
+    { _shadows.remove( object ); }
 
     //____________________________________________________________________________________
     void FrameShadowBase::init()
@@ -304,32 +259,12 @@ namespace Oxygen
         // adjust geometry to take out part that is not rendered anyway
         rect.adjust( 1, 1, -1, -1 );
 
-        // adjust geometry
-        const int shadowSize( 3 );
-        switch( shadowArea() )
+        // mask out the inside of the frame, so that the overlay is not involved
+        // in viewport updates that do not touch the border
+        if( rect.size() != size() || mask().isEmpty() )
         {
-
-            case ShadowAreaTop:
-            rect.setHeight( shadowSize );
-            break;
-
-            case ShadowAreaBottom:
-            rect.setTop( rect.bottom() - shadowSize + 1 );
-            break;
-
-            case ShadowAreaLeft:
-            rect.setWidth(shadowSize);
-            rect.adjust(0, shadowSize, 0, -shadowSize );
-            break;
-
-
-            case ShadowAreaRight:
-            rect.setLeft(rect.right() - shadowSize + 1 );
-            rect.adjust(0, shadowSize, 0, -shadowSize );
-            break;
-
-            default:
-            return;
+            const QRect local( QPoint( 0, 0 ), rect.size() );
+            setMask( QRegion( local ).subtracted( QRegion( local.adjusted( shadowSize, shadowSize, -shadowSize, -shadowSize ) ) ) );
         }
 
         setGeometry(rect);
@@ -384,6 +319,7 @@ namespace Oxygen
 
         // render
         QPainter painter(this);
+        const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
         painter.setClipRegion( event->region() );
 
         StyleOptions options( HoleOutline );
@@ -415,20 +351,12 @@ namespace Oxygen
             rect.right() - parentRect.right(),
             rect.bottom() - parentRect.bottom() ) );
 
-        const int shadowSize( 3 );
-        switch( shadowArea() )
+        // only top and bottom borders are rendered
+        if( rect.size() != size() || mask().isEmpty() )
         {
-
-            case ShadowAreaTop:
-            rect.setHeight( shadowSize );
-            break;
-
-            case ShadowAreaBottom:
-            rect.setTop( rect.bottom() - shadowSize + 1 );
-            break;
-
-            default:
-            return;
+            QRegion mask( 0, 0, rect.width(), shadowSize );
+            mask += QRegion( 0, rect.height() - shadowSize, rect.width(), shadowSize );
+            setMask( mask );
         }
 
         setGeometry(rect);
@@ -447,29 +375,37 @@ namespace Oxygen
         const QRect parentRect( parent->contentsRect() );
         const QRect rect( parentRect.adjusted( margins().left(), margins().top(), margins().right(), margins().bottom() ) );
 
-        QPixmap pixmap( _helper.highDpiPixmap( size() ) );
+        // cached pixmaps must match the device being painted on
+        const DevicePixelRatio::Scope devicePixelRatioScope( this );
+
+        // only render the updated parts, which are restricted to the top and bottom strips of the mask.
+        // One pixmap is rendered per strip, rather than one covering their bounding rect
+        const QRegion region( mask().isEmpty() ? event->region():event->region().intersected( mask() ) );
+        QPainter painter( this );
+        for( const QRect& updateRect:region )
         {
 
-            pixmap.fill( Qt::transparent );
-            QPainter painter( &pixmap );
-            painter.setClipRegion( event->region() );
-            painter.setRenderHints( QPainter::Antialiasing );
-            painter.translate( -geometry().topLeft() );
-            painter.setCompositionMode(QPainter::CompositionMode_DestinationOver);
-            painter.setPen( Qt::NoPen );
-            _helper.renderMenuBackground( &painter, geometry(), parent, parent->palette() );
+            QPixmap pixmap( _helper.highDpiPixmap( updateRect.size() ) );
+            {
 
-            // mask
-            painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
-            painter.setBrush( Qt::black );
-            painter.drawRoundedRect( QRectF(rect), 2.5, 2.5 );
+                pixmap.fill( Qt::transparent );
+                QPainter pixmapPainter( &pixmap );
+                pixmapPainter.setRenderHints( QPainter::Antialiasing );
+                pixmapPainter.translate( -geometry().topLeft() - updateRect.topLeft() );
+                pixmapPainter.setCompositionMode(QPainter::CompositionMode_DestinationOver);
+                pixmapPainter.setPen( Qt::NoPen );
+                _helper.renderMenuBackground( &pixmapPainter, updateRect.translated( geometry().topLeft() ), parent, parent->palette() );
 
-        }
+                // mask
+                pixmapPainter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
+                pixmapPainter.setBrush( Qt::black );
+                pixmapPainter.drawRoundedRect( QRectF(rect), 2.5, 2.5 );
 
-        QPainter painter( this );
-        painter.setClipRegion( event->region() );
-        painter.fillRect( rect, Qt::transparent );
-        painter.drawPixmap( QPoint(0,0), pixmap );
+            }
+
+            painter.drawPixmap( updateRect.topLeft(), pixmap );
+
+        }
 
         return;
 
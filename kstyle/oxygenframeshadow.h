@@ -18,8 +18,8 @@
 #include "oxygenstylehelper.h"
 
 #include <QEvent>
+#include <QHash>
 #include <QObject>
-#include <QSet>
 
 #include <QWidget>
 #include <QPaintEvent>
@@ -28,6 +28,8 @@
 namespace Oxygen
 {
 
+    class FrameShadowBase;
+
     //* shadow manager
     class FrameShadowFactory: public QObject
     {
@@ -49,7 +51,7 @@ namespace Oxygen
 
         //* true if widget is registered
         bool isRegistered( const QWidget* widget ) const
-        { return _registeredWidgets.contains( widget ); }
+        { return _shadows.contains( widget ); }
 
         //* event filter
         bool eventFilter( QObject*, QEvent*) override;
@@ -70,6 +72,9 @@ namespace Oxygen
 
         private:
 
+        //* shadow overlay associated to a given widget, if any
+        FrameShadowBase* shadow( const QObject* ) const;
+
         //* install shadows on given widget
         void installShadows( QWidget*, StyleHelper&, bool flat = false );
 
@@ -85,14 +90,15 @@ namespace Oxygen
         //* update shadows
         void update( QObject* ) const;
 
-        //* install shadow on given side
-        void installShadow( QWidget*, StyleHelper&, ShadowArea, bool flat = false ) const;
-
         //* needed to block ChildAdded events when creating shadows
         AddEventFilter _addEventFilter;
 
-        //* set of registered widgets
-        QSet<const QObject*> _registeredWidgets;
+        //* registered widgets and matching shadow overlay
+        /**
+        a single overlay, masked to the frame border, is used per widget
+        rather than one child widget per side
+        */
+        QHash<const QObject*, WeakPointer<FrameShadowBase>> _shadows;
 
     };
 
@@ -106,18 +112,9 @@ namespace Oxygen
         public:
 
         //* constructor
-        explicit FrameShadowBase( ShadowArea area ):
-            _area( area )
+        explicit FrameShadowBase( void )
         {}
 
-        //* shadow area
-        void setShadowArea(ShadowArea area)
-        { _area = area; }
-
-        //* shadow area
-        const ShadowArea& shadowArea() const
-        { return _area; }
-
         //* set contrast
         void setHasContrast( bool value )
         {
@@ -157,10 +154,10 @@ namespace Oxygen
         void setMargins( const QMargins& margins )
         { _margins = margins; }
 
-        private:
+        //* shadow size
+        static const int shadowSize = 3;
 
-        //* shadow area
-        ShadowArea _area;
+        private:
 
         //* margins
         /** offsets between update rect and parent widget rect. It is set via updateGeometry */
@@ -180,8 +177,7 @@ namespace Oxygen
         public:
 
         //* constructor
-        SunkenFrameShadow( ShadowArea area, StyleHelper& helper ):
-            FrameShadowBase( area ),
+        explicit SunkenFrameShadow( StyleHelper& helper ):
             _helper( helper )
         { init(); }
 
@@ -226,8 +222,7 @@ namespace Oxygen
         public:
 
         //* constructor
-        FlatFrameShadow( ShadowArea area, StyleHelper& helper ):
-            FrameShadowBase( area ),
+        explicit FlatFrameShadow( StyleHelper& helper ):
             _helper( helper )
         { init(); }
 
@@ -12,6 +12,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenmdiwindowshadow.h"
+#include "oxygeneventdispatcher.h"
 #include "oxygenshadowcache.h"
 
 #include <QMdiArea>
@@ -84,6 +85,7 @@ namespace Oxygen
         if( !_shadowTiles.isValid() ) return;
 
         QPainter painter( this );
+        const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
         painter.setRenderHints( QPainter::Antialiasing );
         painter.setClipRegion( event->region() );
         _shadowTiles.render( _shadowTilesRect, &painter );
@@ -127,7 +129,7 @@ namespace Oxygen
             updateShadowZOrder( widget );
         }
 
-        widget->installEventFilter( this );
+        EventDispatcher::instance().subscribe( widget, this, { QEvent::ZOrderChange, QEvent::Destroy, QEvent::Hide, QEvent::Show, QEvent::Move, QEvent::Resize } );
 
         // catch object destruction
         connect( widget, SIGNAL(destroyed(QObject*)), SLOT(widgetDestroyed(QObject*)) );
@@ -140,7 +142,7 @@ namespace Oxygen
     void MdiWindowShadowFactory::unregisterWidget( QWidget* widget )
     {
         if( !isRegistered( widget ) ) return;
-        widget->removeEventFilter( this );
+        EventDispatcher::instance().unsubscribe( widget, this );
         _registeredWidgets.remove( widget );
         removeShadow( widget );
     }
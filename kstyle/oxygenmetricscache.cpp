@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenmetricscache.cpp
+// memoize layout metrics that depend on a small set of option fields
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: LGPL-2.0-only
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenmetricscache.h"
+
+namespace Oxygen
+{
+
+    //* maximum number of memoized entries, per kind
+    static const int metricsCacheSize = 1024;
+
+    //____________________________________________________________________
+    MetricsCache::MetricsCache( void ):
+        _sizes( metricsCacheSize ),
+        _rects( metricsCacheSize )
+    {}
+
+    //____________________________________________________________________
+    void MetricsCache::setEnabled( bool value )
+    {
+        _sizes.setMaxCost( value ? metricsCacheSize : 0 );
+        _rects.setMaxCost( value ? metricsCacheSize : 0 );
+    }
+
+    //____________________________________________________________________
+    void MetricsCache::clear( void )
+    {
+        _sizes.clear();
+        _rects.clear();
+    }
+
+    //____________________________________________________________________
+    MetricsCache::Key MetricsCache::sizeKey( QStyle::ContentsType element, const QStyleOption& option, const QSize& contentsSize )
+    {
+
+        Key key( option );
+        key._element = element;
+        key._rect = QRect( QPoint(), contentsSize );
+
+        switch( element )
+        {
+
+            case QStyle::CT_PushButton:
+            {
+
+                const QStyleOptionButton* buttonOption( qstyleoption_cast<const QStyleOptionButton*>( &option ) );
+                if( !buttonOption ) return key;
+
+                // invalid icon size falls back to PM_SmallIconSize, which can change at runtime
+                const bool hasIcon( !buttonOption->icon.isNull() );
+                if( hasIcon && !buttonOption->iconSize.isValid() ) return key;
+
+                key._features = bool( buttonOption->features & QStyleOptionButton::HasMenu ) | ( hasIcon << 1 ) | ( buttonOption->text.isEmpty() << 2 );
+                key._value = hasIcon ? buttonOption->iconSize.height():0;
+                key._valid = true;
+                return key;
+
+            }
+
+            case QStyle::CT_MenuItem:
+            {
+
+                const QStyleOptionMenuItem* menuItemOption( qstyleoption_cast<const QStyleOptionMenuItem*>( &option ) );
+                if( !menuItemOption ) return key;
+
+                switch( menuItemOption->menuItemType )
+                {
+                    case QStyleOptionMenuItem::Normal:
+                    case QStyleOptionMenuItem::DefaultItem:
+                    case QStyleOptionMenuItem::SubMenu:
+                    {
+                        const bool hasAccelerator( menuItemOption->text.indexOf( QLatin1Char( '\t' ) ) >= 0 );
+                        key._features = int( menuItemOption->menuItemType ) | ( menuItemOption->menuHasCheckableItems << 8 ) | ( hasAccelerator << 9 );
+                        key._value = menuItemOption->maxIconWidth;
+                        key._valid = true;
+                        return key;
+                    }
+
+                    case QStyleOptionMenuItem::Separator:
+                    {
+                        // separator icons are sized using PM_SmallIconSize
+                        if( !menuItemOption->icon.isNull() ) return key;
+
+                        key._features = int( menuItemOption->menuItemType );
+                        key._text = menuItemOption->text;
+                        key._hasFontMetrics = !key._text.isEmpty();
+                        key._valid = true;
+                        return key;
+                    }
+
+                    default: return key;
+                }
+
+            }
+
+            case QStyle::CT_TabBarTab:
+            {
+
+                const QStyleOptionTab* tabOption( qstyleoption_cast<const QStyleOptionTab*>( &option ) );
+                if( !tabOption ) return key;
+
+                key._features =
+                    tabOption->text.isEmpty() |
+                    ( tabOption->icon.isNull() << 1 ) |
+                    ( tabOption->leftButtonSize.isEmpty() << 2 ) |
+                    ( int( tabOption->shape ) << 3 );
+                key._valid = true;
+                return key;
+
+            }
+
+            case QStyle::CT_HeaderSection:
+            {
+
+                const QStyleOptionHeader* headerOption( qstyleoption_cast<const QStyleOptionHeader*>( &option ) );
+                if( !headerOption ) return key;
+
+                key._features =
+                    int( headerOption->orientation ) |
+                    ( headerOption->icon.isNull() << 4 ) |
+                    ( int( headerOption->sortIndicator ) << 5 );
+                key._text = headerOption->text;
+                key._hasFontMetrics = true;
+                key._valid = true;
+                return key;
+
+            }
+
+            default: return key;
+
+        }
+
+    }
+
+    //____________________________________________________________________
+    MetricsCache::Key MetricsCache::rectKey( QStyle::ComplexControl element, const QStyleOptionComplex& option, QStyle::SubControl subControl, int textFlags )
+    {
+
+        Key key( option );
+        key._element = element;
+        key._subControl = subControl;
+        key._direction = int( option.direction );
+        key._rect = option.rect;
+
+        switch( element )
+        {
+
+            case QStyle::CC_ScrollBar:
+            {
+
+                switch( subControl )
+                {
+                    case QStyle::SC_ScrollBarSubLine:
+                    case QStyle::SC_ScrollBarAddLine:
+                    case QStyle::SC_ScrollBarGroove:
+                    case QStyle::SC_ScrollBarSlider:
+                    case QStyle::SC_ScrollBarSubPage:
+                    case QStyle::SC_ScrollBarAddPage:
+                    break;
+
+                    default: return key;
+                }
+
+                const QStyleOptionSlider* sliderOption( qstyleoption_cast<const QStyleOptionSlider*>( &option ) );
+                if( !sliderOption ) return key;
+
+                key._features =
+                    bool( option.state & QStyle::State_Horizontal ) |
+                    ( sliderOption->upsideDown << 1 ) |
+                    ( quint64( quint32( sliderOption->pageStep ) ) << 32 );
+                key._range = ( quint64( quint32( sliderOption->minimum ) ) << 32 ) | quint32( sliderOption->maximum );
+                key._value = sliderOption->sliderPosition;
+                key._valid = true;
+                return key;
+
+            }
+
+            case QStyle::CC_GroupBox:
+            {
+
+                switch( subControl )
+                {
+                    case QStyle::SC_GroupBoxContents:
+                    case QStyle::SC_GroupBoxCheckBox:
+                    case QStyle::SC_GroupBoxLabel:
+                    break;
+
+                    default: return key;
+                }
+
+                const QStyleOptionGroupBox* groupBoxOption( qstyleoption_cast<const QStyleOptionGroupBox*>( &option ) );
+                if( !groupBoxOption ) return key;
+
+                // text flags change with the mnemonics visibility
+                key._features = bool( groupBoxOption->subControls & QStyle::SC_GroupBoxCheckBox ) | ( qint64( textFlags ) << 1 );
+                key._text = groupBoxOption->text;
+                key._hasFontMetrics = true;
+                key._valid = true;
+                return key;
+
+            }
+
+            default: return key;
+
+        }
+
+    }
+
+}
@@ -0,0 +1,182 @@
+#ifndef oxygenmetricscache_h
+#define oxygenmetricscache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenmetricscache.h
+// memoize layout metrics that depend on a small set of option fields
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: LGPL-2.0-only
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenhelper.h"
+
+#include <QFontMetrics>
+#include <QRect>
+#include <QSize>
+#include <QString>
+#include <QStyle>
+#include <QStyleOption>
+
+namespace Oxygen
+{
+
+    //* memoize sizeFromContents and subControlRect results
+    /*!
+    only elements whose result depends exclusively on the option fields stored in the key
+    are memoized. Everything else, including anything that depends on the widget,
+    goes straight to the style. The cache must be cleared whenever the configuration changes
+    */
+    class MetricsCache
+    {
+
+        public:
+
+        //* signature of the option fields relevant to a given element
+        class Key
+        {
+
+            public:
+
+            //* constructor
+            explicit Key( const QStyleOption& option ):
+                _fontMetrics( option.fontMetrics )
+            {}
+
+            //* validity
+            bool isValid( void ) const
+            { return _valid; }
+
+            //* equal to operator
+            bool operator == ( const Key& other ) const
+            {
+                return
+                    _valid == other._valid &&
+                    _element == other._element &&
+                    _subControl == other._subControl &&
+                    _direction == other._direction &&
+                    _rect == other._rect &&
+                    _features == other._features &&
+                    _range == other._range &&
+                    _value == other._value &&
+                    _text == other._text &&
+                    _hasFontMetrics == other._hasFontMetrics &&
+                    ( !_hasFontMetrics || _fontMetrics == other._fontMetrics );
+            }
+
+            //* hash
+            /*! font metrics are left out, since they only differ when the font does */
+            friend uint qHash( const Key& key, uint seed = 0 )
+            {
+                return qHash( ( quint64( key._element ) << 32 ) | ( quint64( key._subControl ) << 8 ) | quint64( key._direction ), seed ) ^
+                    qHash( ( quint64( quint32( key._rect.x() ) ) << 32 ) | quint32( key._rect.y() ), seed ) ^
+                    qHash( ( quint64( quint32( key._rect.width() ) ) << 32 ) | quint32( key._rect.height() ), seed ) ^
+                    qHash( key._features, seed ) ^
+                    qHash( key._range ^ ( key._value << 1 ), seed ) ^
+                    qHash( key._text, seed );
+            }
+
+            private:
+
+            //* validity
+            bool _valid = false;
+
+            //* element (contents type or complex control)
+            int _element = 0;
+
+            //* sub control
+            int _subControl = 0;
+
+            //* layout direction
+            int _direction = 0;
+
+            //* rect or contents size
+            QRect _rect;
+
+            //* element specific packed option fields
+            qint64 _features = 0;
+            qint64 _range = 0;
+            qint64 _value = 0;
+
+            //* text, when relevant
+            QString _text;
+
+            //* true if font metrics are relevant
+            bool _hasFontMetrics = false;
+
+            //* font metrics
+            QFontMetrics _fontMetrics;
+
+            friend class MetricsCache;
+
+        };
+
+        //* constructor
+        explicit MetricsCache( void );
+
+        //* enable state
+        void setEnabled( bool );
+
+        //* clear
+        void clear( void );
+
+        //* add memoized sizes and rects to report
+        void memoryFootprint( MemoryFootprint& footprint ) const
+        {
+            footprint.add( QStringLiteral( "metrics" ), QStringLiteral( "sizes" ), _sizes.usage() );
+            footprint.add( QStringLiteral( "metrics" ), QStringLiteral( "rects" ), _rects.usage() );
+        }
+
+        //*@name sizeFromContents
+        //@{
+
+        //* key for given contents type. Invalid if the result cannot be memoized
+        static Key sizeKey( QStyle::ContentsType, const QStyleOption&, const QSize& );
+
+        //* find size matching key. Returns true on success
+        bool findSize( const Key& key, QSize& size )
+        {
+            if( const QSize* cached = _sizes.object( key ) ) { size = *cached; return true; }
+            else return false;
+        }
+
+        //* insert size
+        void insertSize( const Key& key, const QSize& size )
+        { if( _sizes.enabled() ) _sizes.insert( key, new QSize( size ) ); }
+
+        //@}
+
+        //*@name subControlRect
+        //@{
+
+        //* key for given complex control and subcontrol. Invalid if the result cannot be memoized
+        static Key rectKey( QStyle::ComplexControl, const QStyleOptionComplex&, QStyle::SubControl, int textFlags );
+
+        //* find rect matching key. Returns true on success
+        bool findRect( const Key& key, QRect& rect )
+        {
+            if( const QRect* cached = _rects.object( key ) ) { rect = *cached; return true; }
+            else return false;
+        }
+
+        //* insert rect
+        void insertRect( const Key& key, const QRect& rect )
+        { if( _rects.enabled() ) _rects.insert( key, new QRect( rect ) ); }
+
+        //@}
+
+        private:
+
+        //* sizes
+        BaseCache<QSize, Key> _sizes;
+
+        //* rects
+        BaseCache<QRect, Key> _rects;
+
+    };
+
+}
+
+#endif
@@ -11,9 +11,11 @@
 
 #include "oxygenshadowhelper.h"
 
+#include "oxygeneventdispatcher.h"
 #include "oxygenpropertynames.h"
 #include "oxygenshadowcache.h"
 #include "oxygenstylehelper.h"
+#include "oxygenwidgettraits.h"
 
 #include <QApplication>
 #include <QDockWidget>
@@ -58,6 +60,32 @@ namespace Oxygen
 
     }
 
+    //______________________________________________
+    void ShadowHelper::memoryFootprint( MemoryFootprint& footprint ) const
+    {
+
+        const QString category( QStringLiteral( "shadows" ) );
+        shadowCache().memoryFootprint( footprint, category );
+
+        MemoryFootprint::Usage tileSets;
+        for( const TileSet* tileSet:{ &_tiles, &_dockTiles } )
+        { if( tileSet->isValid() ) tileSets += MemoryFootprint::Usage( 1, MemoryFootprint::bytes( *tileSet ) ); }
+        footprint.add( category, QStringLiteral( "tileSets" ), tileSets );
+
+        // tiles are uploaded once to the window system, as X pixmaps or wayland buffers, and shared by all windows
+        MemoryFootprint::Usage platformTiles;
+        for( const QVector<KWindowShadowTile::Ptr>* tiles:{ &_platformTiles, &_platformDockTiles } )
+        {
+            for( const KWindowShadowTile::Ptr& tile:*tiles )
+            { platformTiles += MemoryFootprint::Usage( 1, MemoryFootprint::bytes( tile->image() ) ); }
+        }
+
+        footprint.add( category, QStringLiteral( "platformTiles" ), platformTiles );
+        footprint.add( category, QStringLiteral( "windowShadows" ), _shadows.size() );
+        footprint.add( category, QStringLiteral( "registeredWidgets" ), _widgets.size() );
+
+    }
+
     //_______________________________________________________
     bool ShadowHelper::registerWidget( QWidget* widget, bool force )
     {
@@ -73,9 +101,8 @@ namespace Oxygen
         installShadows( widget );
         _widgets.insert( widget );
 
-        // install event filter
-        widget->removeEventFilter( this );
-        widget->installEventFilter( this );
+        // subscribe to events
+        EventDispatcher::instance().subscribe( widget, this, { QEvent::WinIdChange } );
 
         // connect destroy signal
         connect( widget, SIGNAL(destroyed(QObject*)), SLOT(widgetDeleted(QObject*)) );
@@ -89,8 +116,8 @@ namespace Oxygen
     {
         if( _widgets.remove( widget ) )
         {
-            // uninstall the event filter
-            widget->removeEventFilter( this );
+            // unsubscribe from events
+            EventDispatcher::instance().unsubscribe( widget, this );
 
             // disconnect all signals
             disconnect( widget, nullptr, this, nullptr );
@@ -182,19 +209,22 @@ namespace Oxygen
 
     //_______________________________________________________
     bool ShadowHelper::isMenu( QWidget* widget ) const
-    { return qobject_cast<QMenu*>( widget ); }
+    { return WidgetTraits::get( widget ).is( WidgetTraits::Menu ); }
 
     //_______________________________________________________
     bool ShadowHelper::isToolTip( QWidget* widget ) const
-    { return widget->inherits( "QTipLabel" ) || (widget->windowFlags() & Qt::WindowType_Mask) == Qt::ToolTip; }
+    { return WidgetTraits::get( widget ).is( WidgetTraits::TipLabel ) || (widget->windowFlags() & Qt::WindowType_Mask) == Qt::ToolTip; }
 
     //_______________________________________________________
     bool ShadowHelper::isDockWidget( QWidget* widget ) const
-    { return qobject_cast<QDockWidget*>( widget ); }
+    { return WidgetTraits::get( widget ).is( WidgetTraits::DockWidget ); }
 
     //_______________________________________________________
     bool ShadowHelper::isToolBar( QWidget* widget ) const
-    { return qobject_cast<QToolBar*>( widget ) || widget->inherits( "Q3ToolBar" ); }
+    {
+        const WidgetTraits traits( WidgetTraits::get( widget ) );
+        return traits.is( WidgetTraits::ToolBar ) || traits.is( WidgetTraits::Q3ToolBar );
+    }
 
     //_______________________________________________________
     bool ShadowHelper::acceptWidget( QWidget* widget ) const
@@ -208,10 +238,10 @@ namespace Oxygen
         if( isMenu( widget ) ) return true;
 
         // combobox dropdown lists
-        if( widget->inherits( "QComboBoxPrivateContainer" ) ) return true;
+        if( WidgetTraits::get( widget ).is( WidgetTraits::ComboBoxPrivateContainer ) ) return true;
 
         // tooltips
-        if( isToolTip( widget ) && !widget->inherits( "Plasma::ToolTip" ) )
+        if( isToolTip( widget ) && !WidgetTraits::get( widget ).is( WidgetTraits::PlasmaToolTip ) )
         { return true; }
 
         // detached widgets
@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygen.h"
+#include "oxygenmemoryfootprint.h"
 #include "oxygentileset.h"
 
 #include <KWindowShadow>
@@ -58,6 +59,9 @@ namespace Oxygen
         //* load config
         void loadConfig( void );
 
+        //* add shadow caches, tiles and window shadows to report
+        void memoryFootprint( MemoryFootprint& ) const;
+
         //* event filter
         bool eventFilter( QObject*, QEvent* ) override;
 
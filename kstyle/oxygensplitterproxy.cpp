@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygensplitterproxy.h"
+#include "oxygeneventdispatcher.h"
 #include "oxygenstyleconfigdata.h"
 
 #include <QCoreApplication>
@@ -51,13 +52,12 @@ namespace Oxygen
                 SplitterProxy* proxy( new SplitterProxy( widget, _enabled ) );
                 widget->removeEventFilter( &_addEventFilter );
 
-                widget->installEventFilter( proxy );
+                subscribe( widget, proxy );
                 _widgets.insert( widget, proxy );
 
             } else {
 
-                widget->removeEventFilter( iter.value().data() );
-                widget->installEventFilter( iter.value().data() );
+                subscribe( widget, iter.value().data() );
 
             }
 
@@ -75,13 +75,12 @@ namespace Oxygen
                 SplitterProxy* proxy( new SplitterProxy( window, _enabled ) );
                 window->removeEventFilter( &_addEventFilter );
 
-                widget->installEventFilter( proxy );
+                subscribe( widget, proxy );
                 _widgets.insert( window, proxy );
 
             } else {
 
-                widget->removeEventFilter( iter.value().data() );
-                widget->installEventFilter( iter.value().data() );
+                subscribe( widget, iter.value().data() );
 
             }
 
@@ -103,6 +102,14 @@ namespace Oxygen
 
     }
 
+    //____________________________________________________________________
+    void SplitterFactory::subscribe( QWidget* widget, SplitterProxy* proxy )
+    {
+        EventDispatcher::instance().subscribe( widget, proxy, {
+            QEvent::HoverEnter, QEvent::HoverMove, QEvent::HoverLeave,
+            QEvent::CursorChange, QEvent::WindowDeactivate, QEvent::MouseButtonRelease } );
+    }
+
     //____________________________________________________________________
     SplitterProxy::SplitterProxy( QWidget* parent, bool enabled ):
         QWidget( parent ),
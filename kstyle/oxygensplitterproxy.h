@@ -54,6 +54,9 @@ namespace Oxygen
 
         private:
 
+        //* subscribe proxy to events of given widget
+        void subscribe( QWidget*, SplitterProxy* );
+
         //* enabled state
         bool _enabled = false;
 
@@ -40,13 +40,16 @@
 #include "oxygenblurhelper.h"
 #include "oxygenframeshadow.h"
 #include "oxygenmdiwindowshadow.h"
+#include "oxygenmetricscache.h"
 #include "oxygenmnemonics.h"
+#include "oxygenprofiler.h"
 #include "oxygenpropertynames.h"
 #include "oxygenshadowhelper.h"
 #include "oxygensplitterproxy.h"
 #include "oxygenstyleconfigdata.h"
 #include "oxygentransitions.h"
 #include "oxygenwidgetexplorer.h"
+#include "oxygenwidgettraits.h"
 #include "oxygenwindowmanager.h"
 
 #include <QAbstractButton>
@@ -72,6 +75,7 @@
 #include <QSpinBox>
 #include <QSplitterHandle>
 #include <QTextEdit>
+#include <QTextStream>
 #include <QToolButton>
 
 #include <KColorUtils>
@@ -223,6 +227,7 @@ namespace Oxygen
         ,_frameShadowFactory( new FrameShadowFactory( this ) )
         ,_mdiWindowShadowFactory( new MdiWindowShadowFactory( this, *_helper ) )
         ,_mnemonics( new Mnemonics( this ) )
+        ,_metricsCache( new MetricsCache() )
         ,_blurHelper( new BlurHelper( this, *_helper ) )
         ,_widgetExplorer( new WidgetExplorer( this ) )
         ,_tabBarData( new OxygenPrivate::TabBarData( this ) )
@@ -238,6 +243,24 @@ namespace Oxygen
             QStringLiteral( "org.kde.Oxygen.Style" ),
             QStringLiteral( "reparseConfiguration" ), this, SLOT(configurationChanged()) );
 
+        // paint time profiling, see Profiler
+        dbus.connect( QString(),
+            QStringLiteral( "/OxygenStyle" ),
+            QStringLiteral( "org.kde.Oxygen.Style" ),
+            QStringLiteral( "setProfilingEnabled" ), this, SLOT(setProfilingEnabled(bool)) );
+
+        dbus.connect( QString(),
+            QStringLiteral( "/OxygenStyle" ),
+            QStringLiteral( "org.kde.Oxygen.Style" ),
+            QStringLiteral( "dumpProfile" ), this, SLOT(dumpProfile()) );
+
+        dbus.connect( QString(),
+            QStringLiteral( "/OxygenStyle" ),
+            QStringLiteral( "org.kde.Oxygen.Style" ),
+            QStringLiteral( "dumpMemoryFootprint" ), this, SLOT(dumpMemoryFootprint()) );
+
+        Profiler::initialize();
+
         // call the slot directly; this initial call will set up things that also
         // need to be reset when the system palette changes
         loadConfiguration();
@@ -252,6 +275,7 @@ namespace Oxygen
         // deleted
         delete _shadowHelper;
         delete _helper;
+        delete _metricsCache;
     }
 
     //______________________________________________________________
@@ -268,19 +292,22 @@ namespace Oxygen
         _shadowHelper->registerWidget( widget );
         _splitterFactory->registerWidget( widget );
 
+        // widget class traits
+        const WidgetTraits traits( WidgetTraits::get( widget ) );
+
         // scroll areas
-        if( QAbstractScrollArea* scrollArea = qobject_cast<QAbstractScrollArea*>( widget ) )
-        { polishScrollArea( scrollArea ); }
+        if( traits.is( WidgetTraits::AbstractScrollArea ) )
+        { polishScrollArea( static_cast<QAbstractScrollArea*>( widget ) ); }
 
         // several widgets set autofill background to false, which effectively breaks the background
         // gradient rendering. Instead of patching all concerned applications,
         // we change the background here
-        if( widget->inherits( "MessageList::Core::Widget" ) )
+        if( traits.is( WidgetTraits::MessageListWidget ) )
         { widget->setAutoFillBackground( false ); }
 
         // adjust layout for K3B themed headers
         // FIXME: to be removed when fixed upstream
-        if( widget->inherits( "K3b::ThemedHeader" ) && widget->layout() )
+        if( traits.is( WidgetTraits::K3bThemedHeader ) && widget->layout() )
         {
             widget->layout()->setContentsMargins( 0, 0, 0, 0 );
             _frameShadowFactory->setHasContrast( widget, true );
@@ -295,7 +322,7 @@ namespace Oxygen
 
             // set background as styled
             widget->setAttribute( Qt::WA_StyledBackground );
-            widget->installEventFilter( _topLevelManager );
+            EventDispatcher::instance().subscribe( widget, _topLevelManager, { QEvent::Show } );
 
             break;
 
@@ -311,26 +338,26 @@ namespace Oxygen
         }
 
         if(
-            qobject_cast<QAbstractItemView*>( widget )
-            || qobject_cast<QAbstractSpinBox*>( widget )
-            || qobject_cast<QCheckBox*>( widget )
-            || qobject_cast<QComboBox*>( widget )
-            || qobject_cast<QDial*>( widget )
-            || qobject_cast<QLineEdit*>( widget )
-            || qobject_cast<QPushButton*>( widget )
-            || qobject_cast<QRadioButton*>( widget )
-            || qobject_cast<QScrollBar*>( widget )
-            || qobject_cast<QSlider*>( widget )
-            || qobject_cast<QSplitterHandle*>( widget )
-            || qobject_cast<QTabBar*>( widget )
-            || qobject_cast<QTextEdit*>( widget )
-            || qobject_cast<QToolButton*>( widget )
-            || widget->inherits( "KTextEditor::View" )
+            traits.is( WidgetTraits::AbstractItemView )
+            || traits.is( WidgetTraits::AbstractSpinBox )
+            || traits.is( WidgetTraits::CheckBox )
+            || traits.is( WidgetTraits::ComboBox )
+            || traits.is( WidgetTraits::Dial )
+            || traits.is( WidgetTraits::LineEdit )
+            || traits.is( WidgetTraits::PushButton )
+            || traits.is( WidgetTraits::RadioButton )
+            || traits.is( WidgetTraits::ScrollBar )
+            || traits.is( WidgetTraits::Slider )
+            || traits.is( WidgetTraits::SplitterHandle )
+            || traits.is( WidgetTraits::TabBar )
+            || traits.is( WidgetTraits::TextEdit )
+            || traits.is( WidgetTraits::ToolButton )
+            || traits.is( WidgetTraits::KTextEditorView )
             )
         { widget->setAttribute( Qt::WA_Hover ); }
 
         // transparent tooltips
-        if( widget->inherits( "QTipLabel" ) )
+        if( traits.is( WidgetTraits::TipLabel ) )
         {
             widget->setAttribute( Qt::WA_TranslucentBackground );
 
@@ -340,38 +367,39 @@ namespace Oxygen
             #endif
         }
 
-        if( QAbstractItemView *itemView = qobject_cast<QAbstractItemView*>( widget ) )
+        const WidgetTraits parentTraits( WidgetTraits::get( widget->parent() ) );
+        if( traits.is( WidgetTraits::AbstractItemView ) )
         {
 
             // enable hover effects in itemviews' viewport
-            itemView->viewport()->setAttribute( Qt::WA_Hover );
+            static_cast<QAbstractItemView*>( widget )->viewport()->setAttribute( Qt::WA_Hover );
 
 
-        } else if( QAbstractScrollArea* scrollArea = qobject_cast<QAbstractScrollArea*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::AbstractScrollArea ) ) {
 
             // enable hover effect in sunken scrollareas that support focus
-            if( scrollArea->frameShadow() == QFrame::Sunken && widget->focusPolicy()&Qt::StrongFocus )
+            if( static_cast<QAbstractScrollArea*>( widget )->frameShadow() == QFrame::Sunken && widget->focusPolicy()&Qt::StrongFocus )
             { widget->setAttribute( Qt::WA_Hover ); }
 
-        } else if( QGroupBox* groupBox = qobject_cast<QGroupBox*>( widget ) )  {
+        } else if( traits.is( WidgetTraits::GroupBox ) )  {
 
             // checkable group boxes
-            if( groupBox->isCheckable() )
-            { groupBox->setAttribute( Qt::WA_Hover ); }
+            if( static_cast<QGroupBox*>( widget )->isCheckable() )
+            { widget->setAttribute( Qt::WA_Hover ); }
 
-        } else if( qobject_cast<QAbstractButton*>( widget ) && qobject_cast<QDockWidget*>( widget->parent() ) ) {
+        } else if( traits.is( WidgetTraits::AbstractButton ) && parentTraits.is( WidgetTraits::DockWidget ) ) {
 
             widget->setAttribute( Qt::WA_Hover );
 
-        } else if( qobject_cast<QAbstractButton*>( widget ) && qobject_cast<QToolBox*>( widget->parent() ) ) {
+        } else if( traits.is( WidgetTraits::AbstractButton ) && parentTraits.is( WidgetTraits::ToolBox ) ) {
 
             widget->setAttribute( Qt::WA_Hover );
 
         }
 
-        if( qobject_cast<QToolButton*>( widget ) )
+        if( traits.is( WidgetTraits::ToolButton ) )
         {
-            if( qobject_cast<QToolBar*>( widget->parent() ) )
+            if( parentTraits.is( WidgetTraits::ToolBar ) )
             {
                 // this hack is needed to have correct text color
                 // rendered in toolbars. This does not really update nicely when changing styles
@@ -388,29 +416,29 @@ namespace Oxygen
 
             if( widget->parentWidget() &&
                 widget->parentWidget()->parentWidget() &&
-                widget->parentWidget()->parentWidget()->inherits( "Gwenview::SideBarGroup" ) )
+                WidgetTraits::get( widget->parentWidget()->parentWidget() ).is( WidgetTraits::GwenviewSideBarGroup ) )
             { widget->setProperty( PropertyNames::toolButtonAlignment, Qt::AlignLeft ); }
 
-        } else if( qobject_cast<QMenuBar*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::MenuBar ) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
 
-        } else if( widget->inherits( "KMultiTabBar" ) ) {
+        } else if( traits.is( WidgetTraits::KMultiTabBar ) ) {
 
             // kMultiTabBar margins are set to unity for alignment
             // with ( usually sunken ) neighbor frames
             widget->setContentsMargins( 1, 1, 1, 1 );
 
-        } else if( qobject_cast<QToolBar*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::ToolBar ) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Show, QEvent::Resize, QEvent::Paint } );
 
-        } else if( qobject_cast<QTabBar*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::TabBar ) ) {
 
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Paint } );
 
-        } else if( widget->inherits( "QTipLabel" ) ) {
+        } else if( traits.is( WidgetTraits::TipLabel ) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
             widget->setAttribute( Qt::WA_TranslucentBackground );
@@ -420,40 +448,40 @@ namespace Oxygen
             widget->setWindowFlags( widget->windowFlags() | Qt::FramelessWindowHint );
             #endif
 
-        } else if( qobject_cast<QScrollBar*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::ScrollBar ) ) {
 
             widget->setAttribute( Qt::WA_OpaquePaintEvent, false );
 
             // when painted in konsole, one needs to paint the window background below
             // the scrollarea, otherwise an ugly flat background is used
-            if( widget->parent() && widget->parent()->inherits( "Konsole::TerminalDisplay" ) )
-            { addEventFilter( widget ); }
+            if( parentTraits.is( WidgetTraits::KonsoleTerminalDisplay ) )
+            { subscribe( widget, { QEvent::Paint } ); }
 
-        } else if( qobject_cast<QDockWidget*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::DockWidget ) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
             widget->setContentsMargins( 3,3,3,3 );
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Show, QEvent::Resize, QEvent::Paint } );
 
-        } else if( qobject_cast<QMdiSubWindow*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::MdiSubWindow ) ) {
 
             widget->setAutoFillBackground( false );
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Paint } );
 
-        } else if( qobject_cast<QToolBox*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::ToolBox ) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
             widget->setAutoFillBackground( false );
             widget->setContentsMargins( 5,5,5,5 );
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Paint } );
 
-        } else if( widget->parentWidget() && widget->parentWidget()->parentWidget() && qobject_cast<QToolBox*>( widget->parentWidget()->parentWidget()->parentWidget() ) ) {
+        } else if( widget->parentWidget() && widget->parentWidget()->parentWidget() && WidgetTraits::get( widget->parentWidget()->parentWidget()->parentWidget() ).is( WidgetTraits::ToolBox ) ) {
 
             widget->setBackgroundRole( QPalette::NoRole );
             widget->setAutoFillBackground( false );
             widget->parentWidget()->setAutoFillBackground( false );
 
-        } else if( qobject_cast<QMenu*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::Menu ) ) {
 
             widget->setAttribute( Qt::WA_TranslucentBackground );
             #ifdef Q_WS_WIN
@@ -461,29 +489,29 @@ namespace Oxygen
             widget->setWindowFlags( widget->windowFlags() | Qt::FramelessWindowHint );
             #endif
 
-        } else if( qobject_cast<QCommandLinkButton*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::CommandLinkButton ) ) {
 
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Paint } );
 
-        } else if( QComboBox *comboBox = qobject_cast<QComboBox*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::ComboBox ) ) {
 
             if( !hasParent( widget, "QWebView" ) )
             {
-                QAbstractItemView *itemView( comboBox->view() );
+                QAbstractItemView *itemView( static_cast<QComboBox*>( widget )->view() );
                 if( itemView && itemView->itemDelegate() && itemView->itemDelegate()->inherits( "QComboBoxDelegate" ) )
                 { itemView->setItemDelegate( new OxygenPrivate::ComboBoxItemDelegate( itemView ) ); }
             }
 
-        } else if( widget->inherits( "QComboBoxPrivateContainer" ) ) {
+        } else if( traits.is( WidgetTraits::ComboBoxPrivateContainer ) ) {
 
-            addEventFilter( widget );
+            subscribe( widget, { QEvent::Show, QEvent::Resize, QEvent::Paint } );
             widget->setAttribute( Qt::WA_TranslucentBackground );
             #ifdef Q_WS_WIN
             //FramelessWindowHint is needed on windows to make WA_TranslucentBackground work properly
             widget->setWindowFlags( widget->windowFlags() | Qt::FramelessWindowHint );
             #endif
 
-        } else if( qobject_cast<QFrame*>( widget ) && widget->parent() && widget->parent()->inherits( "KTitleWidget" ) ) {
+        } else if( traits.is( WidgetTraits::Frame ) && parentTraits.is( WidgetTraits::KTitleWidget ) ) {
 
             widget->setAutoFillBackground( false );
             widget->setBackgroundRole( QPalette::Window );
@@ -515,7 +543,7 @@ namespace Oxygen
 
             case Qt::Window:
             case Qt::Dialog:
-            widget->removeEventFilter( this );
+            EventDispatcher::instance().unsubscribe( widget, _topLevelManager );
             widget->setAttribute( Qt::WA_StyledBackground, false );
             break;
 
@@ -563,14 +591,14 @@ namespace Oxygen
             || qobject_cast<QToolBox*>( widget ) )
         {
             widget->setBackgroundRole( QPalette::Button );
-            widget->removeEventFilter( this );
+            unsubscribe( widget );
             widget->clearMask();
         }
 
         if( qobject_cast<QTabBar*>( widget ) )
         {
 
-            widget->removeEventFilter( this );
+            unsubscribe( widget );
 
         } else if( widget->inherits( "QTipLabel" ) ) {
 
@@ -591,7 +619,7 @@ namespace Oxygen
 
             widget->setBackgroundRole( QPalette::Button );
             widget->setContentsMargins( 0,0,0,0 );
-            widget->removeEventFilter( this );
+            unsubscribe( widget );
 
         } else if( qobject_cast<QMenu*>( widget ) ) {
 
@@ -599,7 +627,7 @@ namespace Oxygen
             widget->setAttribute( Qt::WA_NoSystemBackground, false );
             widget->clearMask();
 
-        } else if( widget->inherits( "QComboBoxPrivateContainer" ) ) widget->removeEventFilter( this );
+        } else if( widget->inherits( "QComboBoxPrivateContainer" ) ) unsubscribe( widget );
 
         KStyle::unpolish( widget );
 
@@ -884,6 +912,27 @@ namespace Oxygen
 
     //______________________________________________________________
     QRect Style::subControlRect( ComplexControl element, const QStyleOptionComplex* option, SubControl subControl, const QWidget* widget ) const
+    {
+
+        if( !option ) return subControlRectImplementation( element, option, subControl, widget );
+
+        // check memoized rects
+        const MetricsCache::Key key( MetricsCache::rectKey( element, *option, subControl, _mnemonics->textFlags() ) );
+        if( !key.isValid() ) return subControlRectImplementation( element, option, subControl, widget );
+
+        QRect rect;
+        if( !_metricsCache->findRect( key, rect ) )
+        {
+            rect = subControlRectImplementation( element, option, subControl, widget );
+            _metricsCache->insertRect( key, rect );
+        }
+
+        return rect;
+
+    }
+
+    //______________________________________________________________
+    QRect Style::subControlRectImplementation( ComplexControl element, const QStyleOptionComplex* option, SubControl subControl, const QWidget* widget ) const
     {
 
         switch( element )
@@ -905,6 +954,28 @@ namespace Oxygen
 
     //______________________________________________________________
     QSize Style::sizeFromContents( ContentsType element, const QStyleOption* option, const QSize& size, const QWidget* widget ) const
+    {
+
+        // QtQuick controls are not memoized, since they need to be registered to the window manager
+        if( !option || ( !widget && option->styleObject ) ) return sizeFromContentsImplementation( element, option, size, widget );
+
+        // check memoized sizes
+        const MetricsCache::Key key( MetricsCache::sizeKey( element, *option, size ) );
+        if( !key.isValid() ) return sizeFromContentsImplementation( element, option, size, widget );
+
+        QSize contentsSize;
+        if( !_metricsCache->findSize( key, contentsSize ) )
+        {
+            contentsSize = sizeFromContentsImplementation( element, option, size, widget );
+            _metricsCache->insertSize( key, contentsSize );
+        }
+
+        return contentsSize;
+
+    }
+
+    //______________________________________________________________
+    QSize Style::sizeFromContentsImplementation( ContentsType element, const QStyleOption* option, const QSize& size, const QWidget* widget ) const
     {
 
         switch( element )
@@ -983,6 +1054,11 @@ namespace Oxygen
     void Style::drawPrimitive( PrimitiveElement element, const QStyleOption* option, QPainter* painter, const QWidget* widget ) const
     {
 
+        Profiler::Scope profilerScope( element );
+
+        // cached pixmaps must match the device being painted on
+        const DevicePixelRatio::Scope devicePixelRatioScope( painter );
+
         StylePrimitive fcn( nullptr );
         switch( element )
         {
@@ -1038,6 +1114,11 @@ namespace Oxygen
     void Style::drawControl( ControlElement element, const QStyleOption* option, QPainter* painter, const QWidget* widget ) const
     {
 
+        Profiler::Scope profilerScope( element );
+
+        // cached pixmaps must match the device being painted on
+        const DevicePixelRatio::Scope devicePixelRatioScope( painter );
+
         StyleControl fcn( nullptr );
         if( element == CE_CapacityBar )
         {
@@ -1095,6 +1176,11 @@ namespace Oxygen
     void Style::drawComplexControl( ComplexControl element, const QStyleOptionComplex* option, QPainter* painter, const QWidget* widget ) const
     {
 
+        Profiler::Scope profilerScope( element );
+
+        // cached pixmaps must match the device being painted on
+        const DevicePixelRatio::Scope devicePixelRatioScope( painter );
+
         StyleComplexControl fcn( nullptr );
         switch( element )
         {
@@ -1203,6 +1289,7 @@ namespace Oxygen
             {
 
                 QPainter painter( widget );
+                const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
                 QPaintEvent *paintEvent = static_cast<QPaintEvent*>( event );
                 painter.setClipRegion( paintEvent->region() );
 
@@ -1250,6 +1337,7 @@ namespace Oxygen
             case QEvent::Paint:
             {
                 QPainter painter( dockWidget );
+                const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
                 QPaintEvent *paintEvent = static_cast<QPaintEvent*>( event );
                 painter.setClipRegion( paintEvent->region() );
 
@@ -1294,6 +1382,7 @@ namespace Oxygen
         {
 
             QPainter painter( subWindow );
+            const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
             QRect clip( static_cast<QPaintEvent*>( event )->rect() );
             if( subWindow->isMaximized() ) _helper->renderWindowBackground( &painter, clip, subWindow, subWindow->palette() );
             else {
@@ -1324,6 +1413,7 @@ namespace Oxygen
 
             // painter
             QPainter painter( button );
+            const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
             painter.setClipRegion( static_cast<QPaintEvent*>( event )->region() );
 
             const bool isFlat = false;
@@ -1408,6 +1498,7 @@ namespace Oxygen
         if( event->type() == QEvent::Paint )
         {
             QPainter painter( widget );
+            const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
             painter.setClipRegion( static_cast<QPaintEvent*>( event )->region() );
             _helper->renderWindowBackground( &painter, widget->rect(), widget,widget->palette() );
         }
@@ -1455,6 +1546,7 @@ namespace Oxygen
             {
 
                 QPainter painter( toolBar );
+                const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
                 QPaintEvent *paintEvent = static_cast<QPaintEvent*>( event );
                 painter.setClipRegion( paintEvent->region() );
 
@@ -1528,6 +1620,7 @@ namespace Oxygen
                 const StyleOptions styleOptions( NoFill );
 
                 QPainter painter( toolBox );
+                const DevicePixelRatio::Scope devicePixelRatioScope( &painter );
                 painter.setClipRegion( static_cast<QPaintEvent*>( event )->region() );
                 renderSlab( &painter, rect, toolBox->palette().color( QPalette::Button ), styleOptions );
 
@@ -1546,11 +1639,90 @@ namespace Oxygen
 
         _shadowHelper->reparseCacheConfig();
 
-        _helper->invalidateCaches();
+        invalidateCaches();
 
         loadConfiguration();
     }
 
+    //____________________________________________________________________
+    void Style::invalidateCaches( void )
+    {
+        _helper->invalidateCaches();
+        _metricsCache->clear();
+    }
+
+    //____________________________________________________________________
+    void Style::setCachesEnabled( bool value )
+    {
+        const int cacheSize( StyleConfigData::cacheEnabled() ?
+            StyleConfigData::maxCacheSize():0 );
+
+        _helper->setMaxCacheSize( value ? cacheSize:0 );
+        _metricsCache->setEnabled( value );
+        invalidateCaches();
+    }
+
+    //____________________________________________________________________
+    void Style::setProfilingEnabled( bool value )
+    { Profiler::setEnabled( value ); }
+
+    //____________________________________________________________________
+    void Style::dumpProfile( void )
+    { Profiler::dump(); }
+
+    //____________________________________________________________________
+    QVariantList Style::memoryFootprint( void ) const
+    {
+        MemoryFootprint footprint;
+        memoryFootprint( footprint );
+        return footprint.toVariantList();
+    }
+
+    //____________________________________________________________________
+    void Style::dumpMemoryFootprint( void ) const
+    {
+        MemoryFootprint footprint;
+        memoryFootprint( footprint );
+
+        QTextStream out( stderr );
+        out << "Oxygen style memory footprint, " << QCoreApplication::applicationName() << "\n";
+        footprint.print( out );
+    }
+
+    //____________________________________________________________________
+    void Style::memoryFootprint( MemoryFootprint& footprint ) const
+    {
+
+        _helper->memoryFootprint( footprint );
+        _shadowHelper->memoryFootprint( footprint );
+        _metricsCache->memoryFootprint( footprint );
+        _animations->memoryFootprint( footprint );
+        _transitions->memoryFootprint( footprint );
+
+        // helper widgets created by the style, and transition buffers
+        MemoryFootprint::Usage frameShadows;
+        MemoryFootprint::Usage mdiWindowShadows;
+        MemoryFootprint::Usage splitterProxies;
+        MemoryFootprint::Usage transitionWidgets;
+        const auto widgets( QApplication::allWidgets() );
+        for( const QWidget* widget:widgets )
+        {
+            if( qobject_cast<const FrameShadowBase*>( widget ) ) ++frameShadows._count;
+            else if( qobject_cast<const MdiWindowShadow*>( widget ) ) ++mdiWindowShadows._count;
+            else if( const TransitionWidget* transition = qobject_cast<const TransitionWidget*>( widget ) ) transitionWidgets += MemoryFootprint::Usage( 1, transition->bufferBytes() );
+
+            // splitter proxy has no meta object of its own
+            else if( dynamic_cast<const SplitterProxy*>( widget ) ) ++splitterProxies._count;
+        }
+
+        const QString category( QStringLiteral( "widgets" ) );
+        footprint.add( category, QStringLiteral( "FrameShadow" ), frameShadows );
+        footprint.add( category, QStringLiteral( "MdiWindowShadow" ), mdiWindowShadows );
+        footprint.add( category, QStringLiteral( "SplitterProxy" ), splitterProxies );
+        footprint.add( category, QStringLiteral( "TransitionWidget" ), transitionWidgets );
+
+    }
+
     //____________________________________________________________________
     QIcon Style::standardIconImplementation(
         StandardPixmap standardPixmap,
@@ -1558,6 +1730,24 @@ namespace Oxygen
         const QWidget *widget ) const
     {
 
+        switch( standardPixmap )
+        {
+
+            case SP_TitleBarNormalButton:
+            case SP_TitleBarShadeButton:
+            case SP_TitleBarUnshadeButton:
+            case SP_TitleBarCloseButton:
+            case SP_DockWidgetCloseButton:
+            case SP_ToolBarHorizontalExtensionButton:
+            case SP_ToolBarVerticalExtensionButton:
+            break;
+
+            default:
+            // do not cache parent style icon, since it may change at runtime
+            return  KStyle::standardIcon( standardPixmap, option, widget );
+
+        }
+
         // MDI windows buttons
         // get button color ( unfortunately option and widget might not be set )
         QColor buttonColor;
@@ -1587,11 +1777,27 @@ namespace Oxygen
 
         }
 
+        /*
+        generated icons are cached, since they are requested again on every dock widget float/unfloat,
+        mdi window creation or palette change. The key must account for colors, device pixel ratio and layout direction
+        */
+        const bool reverseLayout( option && option->direction == Qt::RightToLeft );
+        const quint64 dprKey( quint64( DevicePixelRatio::currentKey() ) & 0x7f );
+        const quint64 key(
+            ( ( iconColor.isValid() ? quint64( iconColor.rgba() ):0 ) << 32 ) |
+            ( dprKey << 24 ) | ( quint64( reverseLayout ) << 23 ) |
+            ( quint64( standardPixmap ) & 0x7fffff ) );
+
+        Cache<QIcon>::Value cache( _helper->standardIconCache( buttonColor ) );
+        if( QIcon* cachedIcon = cache->object( key ) )
+        { return *cachedIcon; }
+
         // contrast
         const QColor contrast( _helper->calcLightColor( buttonColor ) );
         const int iconSize( pixelMetric( QStyle::PM_SmallIconSize ) );
         const QRect rect( 0, 0, iconSize, iconSize );
 
+        QIcon icon;
         switch( standardPixmap )
         {
 
@@ -1604,7 +1810,8 @@ namespace Oxygen
                 QPainter painter( &pixmap );
                 renderTitleBarButton( &painter, rect, buttonColor, iconColor, SC_TitleBarNormalButton );
 
-                return QIcon( pixmap );
+                icon = QIcon( pixmap );
+                break;
 
             }
 
@@ -1616,7 +1823,8 @@ namespace Oxygen
                 QPainter painter( &pixmap );
                 renderTitleBarButton( &painter, rect, buttonColor, iconColor, SC_TitleBarShadeButton );
 
-                return QIcon( pixmap );
+                icon = QIcon( pixmap );
+                break;
             }
 
             case SP_TitleBarUnshadeButton:
@@ -1627,7 +1835,8 @@ namespace Oxygen
                 QPainter painter( &pixmap );
                 renderTitleBarButton( &painter, rect, buttonColor, iconColor, SC_TitleBarUnshadeButton );
 
-                return QIcon( pixmap );
+                icon = QIcon( pixmap );
+                break;
             }
 
             case SP_TitleBarCloseButton:
@@ -1639,13 +1848,13 @@ namespace Oxygen
                 QPainter painter( &pixmap );
                 renderTitleBarButton( &painter, rect, buttonColor, iconColor, SC_TitleBarCloseButton );
 
-                return QIcon( pixmap );
+                icon = QIcon( pixmap );
+                break;
 
             }
 
             case SP_ToolBarHorizontalExtensionButton:
             {
-                QIcon icon;
 
                 // default icon sizes
                 for ( const int iconSize : s_iconSizes )
@@ -1660,7 +1869,6 @@ namespace Oxygen
 
                     painter.translate( QRectF( rect ).center() );
 
-                    const bool reverseLayout( option && option->direction == Qt::RightToLeft );
                     QPolygonF arrow = genericArrow( reverseLayout ? ArrowLeft:ArrowRight, ArrowTiny );
 
                     const qreal width( 1.1 );
@@ -1678,13 +1886,12 @@ namespace Oxygen
 
                 }
 
-                return icon;
+                break;
 
             }
 
             case SP_ToolBarVerticalExtensionButton:
             {
-                QIcon icon;
 
                 // default icon sizes
                 for ( const int iconSize : s_iconSizes )
@@ -1716,15 +1923,17 @@ namespace Oxygen
 
                 }
 
-                return icon;
+                break;
 
             }
 
-            default:
-            // do not cache parent style icon, since it may change at runtime
-            return  KStyle::standardIcon( standardPixmap, option, widget );
+            default: break;
 
         }
+
+        cache->insert( key, new QIcon( icon ) );
+        return icon;
+
     }
 
 
@@ -1772,6 +1981,7 @@ namespace Oxygen
         // widget explorer
         _widgetExplorer->setEnabled( StyleConfigData::widgetExplorerEnabled() );
         _widgetExplorer->setDrawWidgetRects( StyleConfigData::drawWidgetRects() );
+        _widgetExplorer->setDrawRepaintHeatMap( StyleConfigData::drawRepaintHeatMap() );
 
         // splitter proxy
         _splitterFactory->setEnabled( StyleConfigData::splitterProxyEnabled() );
@@ -4460,33 +4670,8 @@ namespace Oxygen
         }
 
         // fade tabbar
-        QPixmap pixmap( gradientRect.size() );
-        {
-            pixmap.fill( Qt::transparent );
-            QPainter painter( &pixmap );
-
-            const bool verticalTabs( isVerticalTab( tabOption ) );
-
-            int width = 0;
-            int height = 0;
-            if( verticalTabs ) height = gradientRect.height();
-            else width = gradientRect.width();
-
-            QLinearGradient grad;
-            if( reverseLayout && !verticalTabs ) grad = QLinearGradient( 0, 0, width, height );
-            else grad = QLinearGradient( width, height, 0, 0 );
-
-            grad.setColorAt( 0, Qt::transparent );
-            grad.setColorAt( 0.6, Qt::black );
-
-            if( widget )
-            { _helper->renderWindowBackground( &painter, pixmap.rect(), widget, palette ); }
-            painter.setCompositionMode( QPainter::CompositionMode_DestinationAtop );
-            painter.fillRect( pixmap.rect(), QBrush( grad ) );
-            painter.end();
-        }
-
-        // draw pixmap
+        /* the faded tile is cached, so that tabbar repaints and scrolling only cost one blit */
+        const QPixmap pixmap( _helper->tabTear( widget, palette, gradientRect.size(), isVerticalTab( tabOption ), reverseLayout ) );
         painter->drawPixmap( gradientRect.topLeft() + QPoint( 0,-1 ), pixmap );
 
         return true;
@@ -36,6 +36,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygen.h"
+#include "oxygeneventdispatcher.h"
 #include "oxygentileset.h"
 #include "config-liboxygen.h"
 
@@ -53,6 +54,7 @@
 #include <QWidget>
 
 #include <QIcon>
+#include <QVariantList>
 
 namespace OxygenPrivate
 {
@@ -65,6 +67,8 @@ namespace Oxygen
     class Animations;
     class FrameShadowFactory;
     class MdiWindowShadowFactory;
+    class MemoryFootprint;
+    class MetricsCache;
     class Mnemonics;
     class ShadowHelper;
     class SplitterFactory;
@@ -148,15 +152,42 @@ namespace Oxygen
         bool eventFilterToolBar( QToolBar*, QEvent* );
         bool eventFilterToolBox( QToolBox*, QEvent* );
 
-        //* install event filter to object, in a unique way
-        void addEventFilter( QObject* object )
-        {
-            object->removeEventFilter( this );
-            object->installEventFilter( this );
-        }
+        //* subscribe to events of given types sent to object, in a unique way
+        void subscribe( QObject* object, const EventDispatcher::EventTypes& types )
+        { EventDispatcher::instance().subscribe( object, this, types ); }
+
+        //* unsubscribe from events sent to object
+        void unsubscribe( QObject* object )
+        { EventDispatcher::instance().unsubscribe( object, this ); }
 
         //@}
 
+        public Q_SLOTS:
+
+        //* drop all cached pixmaps, tilesets and metrics
+        /** used to measure rendering with cold caches */
+        void invalidateCaches( void );
+
+        //* enable or disable all pixmap, tileset and metrics caches
+        /**
+        with caches disabled, the same tilesets and pixmaps are still generated, but rebuilt on every call instead of being reused.
+        Comparing both therefore catches cache keying and staleness errors, not rendering errors in the generated tilesets and pixmaps
+        */
+        void setCachesEnabled( bool );
+
+        //* enable or disable paint time profiling
+        void setProfilingEnabled( bool );
+
+        //* print paint time profile
+        void dumpProfile( void );
+
+        //* memory held by caches, animation data and helper widgets
+        /** returns one map per entry, with category, name, count and bytes keys */
+        QVariantList memoryFootprint( void ) const;
+
+        //* print memory footprint
+        void dumpMemoryFootprint( void ) const;
+
         protected Q_SLOTS:
 
         //* standard icons
@@ -178,6 +209,9 @@ namespace Oxygen
         //* load configuration
         void loadConfiguration();
 
+        //* add caches, animation data and helper widgets to report
+        void memoryFootprint( MemoryFootprint& ) const;
+
         //*@name enumerations and convenience classes
         //@{
 
@@ -244,6 +278,9 @@ namespace Oxygen
         //*@name subcontrol Rect specialized functions
         //@{
 
+        //* non memoized subcontrol rect
+        QRect subControlRectImplementation( ComplexControl, const QStyleOptionComplex*, SubControl, const QWidget* ) const;
+
         QRect groupBoxSubControlRect( const QStyleOptionComplex*, SubControl, const QWidget* ) const;
         QRect toolButtonSubControlRect( const QStyleOptionComplex*, SubControl, const QWidget* ) const;
         QRect comboBoxSubControlRect( const QStyleOptionComplex*, SubControl, const QWidget* ) const;
@@ -256,6 +293,10 @@ namespace Oxygen
 
         //*@name sizeFromContents
         //@{
+
+        //* non memoized size from contents
+        QSize sizeFromContentsImplementation( ContentsType, const QStyleOption*, const QSize&, const QWidget* ) const;
+
         QSize defaultSizeFromContents( const QStyleOption*, const QSize& size, const QWidget* ) const
         { return size; }
 
@@ -623,6 +664,9 @@ namespace Oxygen
         //* keyboard accelerators
         Mnemonics* _mnemonics;
 
+        //* memoized sizeFromContents and subControlRect results
+        MetricsCache* _metricsCache;
+
         //* blur helper
         BlurHelper* _blurHelper;
 
@@ -8,6 +8,7 @@
 */
 
 #include "oxygenstylehelper.h"
+#include "oxygenprofiler.h"
 
 #include <KColorUtils>
 #include <KColorScheme>
@@ -40,6 +41,7 @@ namespace Oxygen
         _roundSlabCache.clear();
         _sliderSlabCache.clear();
         _holeCache.clear();
+        _standardIconCache.clear();
 
         _midColorCache.clear();
 
@@ -53,6 +55,7 @@ namespace Oxygen
         _dockFrameCache.clear();
         _scrollHoleCache.clear();
         _scrollHandleCache.clear();
+        _tabTearCache.clear();
         Helper::invalidateCaches();
     }
 
@@ -72,6 +75,7 @@ namespace Oxygen
         _sliderSlabCache.setMaxCacheSize( value );
         _holeCache.setMaxCacheSize( value );
         _scrollHandleCache.setMaxCacheSize( value );
+        _standardIconCache.setMaxCacheSize( value );
 
         _dockWidgetButtonCache.setMaxCost( value );
         _progressBarCache.setMaxCost( value );
@@ -82,6 +86,38 @@ namespace Oxygen
         _slitCache.setMaxCost( value );
         _dockFrameCache.setMaxCost( value );
         _scrollHoleCache.setMaxCost( value );
+        _tabTearCache.setMaxCost( value );
+
+    }
+
+    //____________________________________________________________________
+    void StyleHelper::memoryFootprint( MemoryFootprint& footprint ) const
+    {
+
+        // base class
+        Helper::memoryFootprint( footprint );
+
+        const QString category( QStringLiteral( "helper" ) );
+        footprint.add( category, QStringLiteral( "slab" ), _slabCache.usage() );
+        footprint.add( category, QStringLiteral( "slabSunken" ), _slabSunkenCache.usage() );
+        footprint.add( category, QStringLiteral( "dialSlab" ), _dialSlabCache.usage() );
+        footprint.add( category, QStringLiteral( "roundSlab" ), _roundSlabCache.usage() );
+        footprint.add( category, QStringLiteral( "sliderSlab" ), _sliderSlabCache.usage() );
+        footprint.add( category, QStringLiteral( "hole" ), _holeCache.usage() );
+        footprint.add( category, QStringLiteral( "scrollHandle" ), _scrollHandleCache.usage() );
+        footprint.add( category, QStringLiteral( "standardIcon" ), _standardIconCache.usage() );
+        footprint.add( category, QStringLiteral( "midColor" ), _midColorCache.usage() );
+
+        footprint.add( category, QStringLiteral( "dockWidgetButton" ), _dockWidgetButtonCache.usage() );
+        footprint.add( category, QStringLiteral( "progressBar" ), _progressBarCache.usage() );
+        footprint.add( category, QStringLiteral( "corner" ), _cornerCache.usage() );
+        footprint.add( category, QStringLiteral( "selection" ), _selectionCache.usage() );
+        footprint.add( category, QStringLiteral( "holeFlat" ), _holeFlatCache.usage() );
+        footprint.add( category, QStringLiteral( "slope" ), _slopeCache.usage() );
+        footprint.add( category, QStringLiteral( "slit" ), _slitCache.usage() );
+        footprint.add( category, QStringLiteral( "dockFrame" ), _dockFrameCache.usage() );
+        footprint.add( category, QStringLiteral( "scrollHole" ), _scrollHoleCache.usage() );
+        footprint.add( category, QStringLiteral( "tabTear" ), _tabTearCache.usage() );
 
     }
 
@@ -260,6 +296,7 @@ namespace Oxygen
         if( QPixmap *cachedPixmap = _dockWidgetButtonCache.object( key ) )
         { return *cachedPixmap; }
 
+        Profiler::Scope profilerScope( Profiler::DockWidgetButton );
 
         QPixmap pixmap( highDpiPixmap( size, size ) );
         pixmap.fill( Qt::transparent );
@@ -297,6 +334,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _cornerCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::RoundCorner );
+
         QPixmap pixmap = QPixmap( size*2, size*2 );
         pixmap.fill( Qt::transparent );
 
@@ -330,6 +369,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _slopeCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::Slope );
+
         QPixmap pixmap( highDpiPixmap( size*4 ) );
         pixmap.fill( Qt::transparent );
 
@@ -448,6 +489,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = cache->object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::Slab );
+
         QPixmap pixmap( highDpiPixmap( size*2 ) );
         pixmap.fill( Qt::transparent );
 
@@ -482,6 +525,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _slabSunkenCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::SlabSunken );
+
         QPixmap pixmap( highDpiPixmap( size*2 ) );
         pixmap.fill( Qt::transparent );
 
@@ -528,6 +573,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _progressBarCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::ProgressBarIndicator );
+
         QRect local( 0, 0, dimension, dimension );
 
         QPixmap pixmap( highDpiPixmap( local.size() ) );
@@ -628,6 +675,8 @@ namespace Oxygen
         if( QPixmap* cachedPixmap = cache->object( key ) )
         { return *cachedPixmap; }
 
+        Profiler::Scope profilerScope( Profiler::DialSlab );
+
         QPixmap pixmap( highDpiPixmap( size ) );
         pixmap.fill( Qt::transparent );
 
@@ -691,6 +740,8 @@ namespace Oxygen
         if( QPixmap* cachedPixmap = cache->object( key ) )
         { return *cachedPixmap; }
 
+        Profiler::Scope profilerScope( Profiler::RoundSlab );
+
         QPixmap pixmap( highDpiPixmap( size*3 ) );
         pixmap.fill( Qt::transparent );
 
@@ -726,6 +777,8 @@ namespace Oxygen
         if( QPixmap *cachedPixmap = cache->object( key ) )
         { return *cachedPixmap; }
 
+        Profiler::Scope profilerScope( Profiler::SliderSlab );
+
         QPixmap pixmap( highDpiPixmap( size*3 ) );
         pixmap.fill( Qt::transparent );
 
@@ -775,6 +828,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _holeFlatCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::HoleFlat );
+
         QPixmap pixmap( highDpiPixmap( size*2 ) );
         pixmap.fill( Qt::transparent );
 
@@ -866,6 +921,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _scrollHoleCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::ScrollHole );
+
 
         QPixmap pixmap( highDpiPixmap( 15 ) );
         pixmap.fill( Qt::transparent );
@@ -963,6 +1020,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = cache->object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::ScrollHandle );
+
         QPixmap pixmap( highDpiPixmap( 2*size ) );
         pixmap.fill( Qt::transparent );
 
@@ -1027,6 +1086,8 @@ namespace Oxygen
         if( TileSet* cachedTileSet = _slitCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::SlitFocused );
+
         QPixmap pixmap( highDpiPixmap( 9 ) );
         pixmap.fill( Qt::transparent );
 
@@ -1048,8 +1109,10 @@ namespace Oxygen
         if( TileSet *cachedTileSet = _dockFrameCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::DockFrame );
+
         int size( 13 );
-        QPixmap pm( size, size );
+        QPixmap pm( highDpiPixmap( size ) );
         pm.fill( Qt::transparent );
 
         QPainter painter( &pm );
@@ -1104,6 +1167,8 @@ namespace Oxygen
         if( TileSet* cachedTileSet = _selectionCache.object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::Selection );
+
         const qreal rounding( 2.5 );
 
         QPixmap pixmap( highDpiPixmap( 32+16, height ) );
@@ -1149,6 +1214,61 @@ namespace Oxygen
 
     }
 
+    //____________________________________________________________________
+    QPixmap StyleHelper::tabTear( const QWidget* widget, const QPalette& palette, const QSize& size, bool vertical, bool reverse )
+    {
+
+        /*
+        the rendered background only depends on the widget position with respect to its window,
+        so that the pixmap can be reused for all repaints of a given tabbar, including when scrolling
+        */
+        TabTearKey key;
+        key._size = size;
+        key._vertical = vertical;
+        key._reverse = reverse && !vertical;
+        key._gradient = _useBackgroundGradient;
+        if( widget )
+        {
+            const QWidget* window( widget->window() );
+            key._color = colorKey( palette.color( window->backgroundRole() ) );
+            key._windowRect = window->rect().translated( -widget->mapTo( window, QPoint( 0, 0 ) ) );
+        }
+
+        if( QPixmap* cachedPixmap = _tabTearCache.object( key ) )
+        { return *cachedPixmap; }
+
+        Profiler::Scope profilerScope( Profiler::TabTear );
+
+        QPixmap pixmap( highDpiPixmap( size ) );
+        pixmap.fill( Qt::transparent );
+
+        QPainter painter( &pixmap );
+
+        int width = 0;
+        int height = 0;
+        if( vertical ) height = size.height();
+        else width = size.width();
+
+        QLinearGradient gradient;
+        if( key._reverse ) gradient = QLinearGradient( 0, 0, width, height );
+        else gradient = QLinearGradient( width, height, 0, 0 );
+
+        gradient.setColorAt( 0, Qt::transparent );
+        gradient.setColorAt( 0.6, Qt::black );
+
+        // pixmap rect, in logical coordinates
+        const QRect rect( QPoint( 0, 0 ), size );
+        if( widget )
+        { renderWindowBackground( &painter, rect, widget, palette ); }
+        painter.setCompositionMode( QPainter::CompositionMode_DestinationAtop );
+        painter.fillRect( rect, QBrush( gradient ) );
+        painter.end();
+
+        _tabTearCache.insert( key, new QPixmap( pixmap ) );
+        return pixmap;
+
+    }
+
     //________________________________________________________________________________________________________
     void StyleHelper::drawInverseGlow(
         QPainter& painter, const QColor& color,
@@ -1221,6 +1341,8 @@ namespace Oxygen
         if( TileSet *cachedTileSet = cache->object( key ) )
         { return *cachedTileSet; }
 
+        Profiler::Scope profilerScope( Profiler::Hole );
+
         // first create shadow
         const int shadowSize( (size*5)/7 );
         QPixmap shadowPixmap( highDpiPixmap( shadowSize*2 ) );
@@ -15,6 +15,8 @@
 
 #include <KWindowSystem>
 
+#include <QIcon>
+
 #if OXYGEN_HAVE_X11
 #include <xcb/xcb.h>
 #endif
@@ -38,6 +40,9 @@ namespace Oxygen
         //* update maximum cache size
         void setMaxCacheSize( int ) override;
 
+        //* add caches memory usage to report
+        void memoryFootprint( MemoryFootprint& ) const override;
+
         //* background gradient
         void setUseBackgroundGradient( bool value )
         { _useBackgroundGradient = value; }
@@ -99,6 +104,11 @@ namespace Oxygen
 
         //@}
 
+        //* standard icons cache, for a given button color
+        /** icons are generated by the style itself, this only takes care of the storage */
+        Cache<QIcon>::Value standardIconCache( const QColor& color )
+        { return _standardIconCache.get( color ); }
+
         //* overloaded window decoration buttons for MDI windows
         QPixmap dockWidgetButton( const QColor& color, bool pressed, int size = 21 );
 
@@ -187,6 +197,9 @@ namespace Oxygen
         //* selection
         TileSet selection( const QColor&, int height, bool custom );
 
+        //* faded window background, rendered on top of tabs hidden behind tabbar scroll buttons
+        QPixmap tabTear( const QWidget*, const QPalette&, const QSize&, bool vertical, bool reverse );
+
         //* inverse glow
         /** this method must be public because it is used directly by OxygenStyle to draw dials */
         void drawInverseGlow( QPainter&, const QColor&, int pad, int size, int rsize ) const;
@@ -230,6 +243,43 @@ namespace Oxygen
         //* initialize
         void init( void );
 
+        //* tab tear cache key
+        /** the faded background depends on the widget position inside its window, which cannot be packed in a single integer */
+        class TabTearKey
+        {
+            public:
+
+            //* equal to operator
+            bool operator == ( const TabTearKey& other ) const
+            {
+                return
+                    _color == other._color &&
+                    _windowRect == other._windowRect &&
+                    _size == other._size &&
+                    _vertical == other._vertical &&
+                    _reverse == other._reverse &&
+                    _gradient == other._gradient;
+            }
+
+            //* hash
+            friend uint qHash( const TabTearKey& key, uint seed = 0 )
+            {
+                return qHash( key._color, seed ) ^
+                    qHash( ( key._windowRect.x() << 16 ) ^ key._windowRect.y(), seed ) ^
+                    qHash( ( key._windowRect.width() << 16 ) ^ key._windowRect.height(), seed ) ^
+                    qHash( ( key._size.width() << 16 ) ^ ( key._size.height() << 3 ) ^
+                    ( key._vertical << 2 ) ^ ( key._reverse << 1 ) ^ key._gradient, seed );
+            }
+
+            quint64 _color = 0;
+            QRect _windowRect;
+            QSize _size;
+            bool _vertical = false;
+            bool _reverse = false;
+            bool _gradient = false;
+
+        };
+
         //* background grandient
         bool _useBackgroundGradient;
 
@@ -239,15 +289,16 @@ namespace Oxygen
         Cache<TileSet> _holeCache;
         Cache<TileSet> _scrollHandleCache;
         Cache<TileSet> _slabCache;
+        Cache<QIcon> _standardIconCache;
 
         //* mid color cache
         ColorCache _midColorCache;
 
         //* dock button cache
-        PixmapCache _dockWidgetButtonCache;
+        DevicePixelRatioCache<QPixmap> _dockWidgetButtonCache;
 
 
-        using TileSetCache = BaseCache<TileSet>;
+        using TileSetCache = DevicePixelRatioCache<TileSet>;
         TileSetCache _slabSunkenCache;
         TileSetCache _cornerCache;
         TileSetCache _holeFlatCache;
@@ -258,6 +309,9 @@ namespace Oxygen
         TileSetCache _selectionCache;
         TileSetCache _progressBarCache;
 
+        //* tab tear cache
+        DevicePixelRatioCache<QPixmap, TabTearKey> _tabTearCache;
+
         #if OXYGEN_HAVE_X11
 
         //* atom used for compositing manager
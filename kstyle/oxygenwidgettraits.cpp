@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenwidgettraits.cpp
+// widget class traits, computed once per meta object
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: LGPL-2.0-only
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenwidgettraits.h"
+
+#include <QAbstractItemView>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QCommandLinkButton>
+#include <QDial>
+#include <QDialog>
+#include <QDockWidget>
+#include <QGroupBox>
+#include <QHash>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QListView>
+#include <QMainWindow>
+#include <QMdiSubWindow>
+#include <QMenu>
+#include <QMenuBar>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QRadioButton>
+#include <QScrollBar>
+#include <QSlider>
+#include <QSpinBox>
+#include <QSplitter>
+#include <QStackedWidget>
+#include <QStatusBar>
+#include <QTabBar>
+#include <QTextEdit>
+#include <QToolBar>
+#include <QToolBox>
+#include <QToolButton>
+#include <QTreeView>
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //* map trait to either a meta object or a class name
+        struct TraitClass
+        {
+            WidgetTraits::Trait trait;
+            const QMetaObject* metaObject;
+            const char* className;
+        };
+
+        //* trait classes
+        const TraitClass traitClasses[] =
+        {
+            { WidgetTraits::AbstractButton, &QAbstractButton::staticMetaObject, nullptr },
+            { WidgetTraits::AbstractItemView, &QAbstractItemView::staticMetaObject, nullptr },
+            { WidgetTraits::AbstractScrollArea, &QAbstractScrollArea::staticMetaObject, nullptr },
+            { WidgetTraits::AbstractSpinBox, &QAbstractSpinBox::staticMetaObject, nullptr },
+            { WidgetTraits::CheckBox, &QCheckBox::staticMetaObject, nullptr },
+            { WidgetTraits::ComboBox, &QComboBox::staticMetaObject, nullptr },
+            { WidgetTraits::CommandLinkButton, &QCommandLinkButton::staticMetaObject, nullptr },
+            { WidgetTraits::Dial, &QDial::staticMetaObject, nullptr },
+            { WidgetTraits::Dialog, &QDialog::staticMetaObject, nullptr },
+            { WidgetTraits::DockWidget, &QDockWidget::staticMetaObject, nullptr },
+            { WidgetTraits::Frame, &QFrame::staticMetaObject, nullptr },
+            { WidgetTraits::GroupBox, &QGroupBox::staticMetaObject, nullptr },
+            { WidgetTraits::HeaderView, &QHeaderView::staticMetaObject, nullptr },
+            { WidgetTraits::Label, &QLabel::staticMetaObject, nullptr },
+            { WidgetTraits::LineEdit, &QLineEdit::staticMetaObject, nullptr },
+            { WidgetTraits::ListView, &QListView::staticMetaObject, nullptr },
+            { WidgetTraits::MainWindow, &QMainWindow::staticMetaObject, nullptr },
+            { WidgetTraits::MdiSubWindow, &QMdiSubWindow::staticMetaObject, nullptr },
+            { WidgetTraits::Menu, &QMenu::staticMetaObject, nullptr },
+            { WidgetTraits::MenuBar, &QMenuBar::staticMetaObject, nullptr },
+            { WidgetTraits::ProgressBar, &QProgressBar::staticMetaObject, nullptr },
+            { WidgetTraits::PushButton, &QPushButton::staticMetaObject, nullptr },
+            { WidgetTraits::RadioButton, &QRadioButton::staticMetaObject, nullptr },
+            { WidgetTraits::ScrollBar, &QScrollBar::staticMetaObject, nullptr },
+            { WidgetTraits::Slider, &QSlider::staticMetaObject, nullptr },
+            { WidgetTraits::SpinBox, &QSpinBox::staticMetaObject, nullptr },
+            { WidgetTraits::Splitter, &QSplitter::staticMetaObject, nullptr },
+            { WidgetTraits::SplitterHandle, &QSplitterHandle::staticMetaObject, nullptr },
+            { WidgetTraits::StackedWidget, &QStackedWidget::staticMetaObject, nullptr },
+            { WidgetTraits::StatusBar, &QStatusBar::staticMetaObject, nullptr },
+            { WidgetTraits::TabBar, &QTabBar::staticMetaObject, nullptr },
+            { WidgetTraits::TextEdit, &QTextEdit::staticMetaObject, nullptr },
+            { WidgetTraits::ToolBar, &QToolBar::staticMetaObject, nullptr },
+            { WidgetTraits::ToolBox, &QToolBox::staticMetaObject, nullptr },
+            { WidgetTraits::ToolButton, &QToolButton::staticMetaObject, nullptr },
+            { WidgetTraits::TreeView, &QTreeView::staticMetaObject, nullptr },
+
+            { WidgetTraits::ComboBoxPrivateContainer, nullptr, "QComboBoxPrivateContainer" },
+            { WidgetTraits::TipLabel, nullptr, "QTipLabel" },
+            { WidgetTraits::ShapedPixmapWidget, nullptr, "QShapedPixmapWidget" },
+            { WidgetTraits::Q3ToolBar, nullptr, "Q3ToolBar" },
+            { WidgetTraits::KCModule, nullptr, "KCModule" },
+            { WidgetTraits::KCommonDecorationButton, nullptr, "KCommonDecorationButton" },
+            { WidgetTraits::KHTMLView, nullptr, "KHTMLView" },
+            { WidgetTraits::KMultiTabBar, nullptr, "KMultiTabBar" },
+            { WidgetTraits::KScreenSaver, nullptr, "KScreenSaver" },
+            { WidgetTraits::KTextEditorView, nullptr, "KTextEditor::View" },
+            { WidgetTraits::KTitleWidget, nullptr, "KTitleWidget" },
+            { WidgetTraits::KWinGeometryTip, nullptr, "KWin::GeometryTip" },
+            { WidgetTraits::PlasmaToolTip, nullptr, "Plasma::ToolTip" },
+            { WidgetTraits::GwenviewSideBarGroup, nullptr, "Gwenview::SideBarGroup" },
+            { WidgetTraits::K3bThemedHeader, nullptr, "K3b::ThemedHeader" },
+            { WidgetTraits::KonsoleTerminalDisplay, nullptr, "Konsole::TerminalDisplay" },
+            { WidgetTraits::MessageListWidget, nullptr, "MessageList::Core::Widget" }
+        };
+
+        static_assert( WidgetTraits::TraitCount <= 64, "too many widget traits" );
+        static_assert( sizeof( traitClasses )/sizeof( TraitClass ) == WidgetTraits::TraitCount, "missing widget trait class" );
+
+        //* compute traits for a given meta object
+        quint64 computeTraits( const QMetaObject* metaObject )
+        {
+
+            quint64 traits( 0 );
+            for( const TraitClass& traitClass:traitClasses )
+            {
+
+                bool inherits( false );
+                if( traitClass.metaObject ) inherits = metaObject->inherits( traitClass.metaObject );
+                else {
+
+                    // same as QObject::inherits, without an instance
+                    for( const QMetaObject* current = metaObject; current && !inherits; current = current->superClass() )
+                    { inherits = !qstrcmp( current->className(), traitClass.className ); }
+
+                }
+
+                if( inherits ) traits |= quint64( 1 ) << traitClass.trait;
+
+            }
+
+            return traits;
+
+        }
+
+    }
+
+    //____________________________________________________________
+    WidgetTraits WidgetTraits::get( const QObject* object )
+    {
+
+        if( !object ) return WidgetTraits();
+
+        // widgets are only ever polished from the GUI thread
+        static QHash<const QMetaObject*, quint64> table;
+
+        const QMetaObject* metaObject( object->metaObject() );
+        auto iter( table.constFind( metaObject ) );
+        if( iter != table.constEnd() ) return WidgetTraits( iter.value() );
+
+        const quint64 traits( computeTraits( metaObject ) );
+        table.insert( metaObject, traits );
+        return WidgetTraits( traits );
+
+    }
+
+}
@@ -0,0 +1,115 @@
+#ifndef oxygenwidgettraits_h
+#define oxygenwidgettraits_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenwidgettraits.h
+// widget class traits, computed once per meta object
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: LGPL-2.0-only
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QObject>
+
+namespace Oxygen
+{
+
+    //* widget class traits
+    /*!
+    records once per QMetaObject which of the classes the style cares about
+    a given object inherits from, so that polishing, registration to the
+    various engines, and mouse press handling reduce to table lookups rather than
+    chains of qobject_cast and QObject::inherits calls
+    */
+    class WidgetTraits
+    {
+
+        public:
+
+        //* traits
+        enum Trait
+        {
+            // Qt classes
+            AbstractButton,
+            AbstractItemView,
+            AbstractScrollArea,
+            AbstractSpinBox,
+            CheckBox,
+            ComboBox,
+            CommandLinkButton,
+            Dial,
+            Dialog,
+            DockWidget,
+            Frame,
+            GroupBox,
+            HeaderView,
+            Label,
+            LineEdit,
+            ListView,
+            MainWindow,
+            MdiSubWindow,
+            Menu,
+            MenuBar,
+            ProgressBar,
+            PushButton,
+            RadioButton,
+            ScrollBar,
+            Slider,
+            SpinBox,
+            Splitter,
+            SplitterHandle,
+            StackedWidget,
+            StatusBar,
+            TabBar,
+            TextEdit,
+            ToolBar,
+            ToolBox,
+            ToolButton,
+            TreeView,
+
+            // classes only known by name
+            ComboBoxPrivateContainer,
+            TipLabel,
+            ShapedPixmapWidget,
+            Q3ToolBar,
+            KCModule,
+            KCommonDecorationButton,
+            KHTMLView,
+            KMultiTabBar,
+            KScreenSaver,
+            KTextEditorView,
+            KTitleWidget,
+            KWinGeometryTip,
+            PlasmaToolTip,
+            GwenviewSideBarGroup,
+            K3bThemedHeader,
+            KonsoleTerminalDisplay,
+            MessageListWidget,
+
+            TraitCount
+        };
+
+        //* traits of a given object's class. Null objects have no traits
+        static WidgetTraits get( const QObject* );
+
+        //* true if object's class inherits the class matching trait
+        bool is( Trait trait ) const
+        { return _traits & ( quint64( 1 ) << trait ); }
+
+        private:
+
+        //* constructor
+        explicit WidgetTraits( quint64 traits = 0 ):
+            _traits( traits )
+        {}
+
+        //* traits bitmask
+        quint64 _traits;
+
+    };
+
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include "oxygenpropertynames.h"
 #include "oxygenstyleconfigdata.h"
 #include "oxygenhelper.h"
+#include "oxygenwidgettraits.h"
 
 #include <QApplication>
 #include <QComboBox>
@@ -139,6 +140,7 @@ namespace Oxygen
         _dragMode( StyleConfigData::WD_FULL ),
         _dragDistance( QApplication::startDragDistance() ),
         _dragDelay( QApplication::startDragTime() ),
+        _blackListAll( false ),
         _dragAboutToStart( false ),
         _dragInProgress( false ),
         _locked( false ),
@@ -154,6 +156,9 @@ namespace Oxygen
         _appEventFilter = new AppEventFilter( this );
         qApp->installEventFilter( _appEventFilter );
 
+        // white and black lists depend on application name
+        connect( qApp, &QCoreApplication::applicationNameChanged, this, &WindowManager::resolveExceptions );
+
     }
 
     //_____________________________________________________________
@@ -229,6 +234,10 @@ namespace Oxygen
         #endif
     }
 
+    //_____________________________________________________________
+    EventDispatcher::EventTypes WindowManager::mouseEvents( void )
+    { return { QEvent::MouseButtonPress, QEvent::MouseMove, QEvent::MouseButtonRelease }; }
+
     //_____________________________________________________________
     void WindowManager::registerWidget( QWidget* widget )
     {
@@ -242,8 +251,7 @@ namespace Oxygen
             to be able to catch the relevant events and prevent
             the drag to happen
             */
-            widget->removeEventFilter( this );
-            widget->installEventFilter( this );
+            EventDispatcher::instance().subscribe( widget, this, mouseEvents() );
 
         }
 
@@ -257,8 +265,7 @@ namespace Oxygen
         if (window) {
             QQuickItem *contentItem = window->contentItem();
             contentItem->setAcceptedMouseButtons( Qt::LeftButton );
-            contentItem->removeEventFilter( this );
-            contentItem->installEventFilter( this );
+            EventDispatcher::instance().subscribe( contentItem, this, mouseEvents() );
         }
 
     }
@@ -267,7 +274,7 @@ namespace Oxygen
     void WindowManager::unregisterWidget( QWidget* widget )
     {
         if( widget )
-        { widget->removeEventFilter( this ); }
+        { EventDispatcher::instance().unsubscribe( widget, this ); }
     }
 
     //_____________________________________________________________
@@ -288,6 +295,8 @@ namespace Oxygen
             if( !id.className().isEmpty() )
             { _whiteList.insert( ExceptionId( exception ) ); }
         }
+
+        resolveExceptions();
     }
 
     //_____________________________________________________________
@@ -307,6 +316,36 @@ namespace Oxygen
             { _blackList.insert( ExceptionId( exception ) ); }
         }
 
+        resolveExceptions();
+
+    }
+
+    //_____________________________________________________________
+    void WindowManager::resolveExceptions( void )
+    {
+
+        _whiteListClassNames.clear();
+        _blackListClassNames.clear();
+        _blackListAll = false;
+        _exceptionVerdicts.clear();
+
+        const QString appName( qApp->applicationName() );
+        for( const ExceptionId &id : std::as_const(_whiteList) )
+        {
+            if( !id.appName().isEmpty() && id.appName() != appName ) continue;
+            _whiteListClassNames.append( id.className().toLatin1() );
+        }
+
+        for( const ExceptionId &id : std::as_const(_blackList) )
+        {
+            if( !id.appName().isEmpty() && id.appName() != appName ) continue;
+
+            // if application name matches and all classes are selected
+            // the grabbing gets disabled entirely
+            if( id.className() == QStringLiteral( "*" ) && !id.appName().isEmpty() ) _blackListAll = true;
+            else _blackListClassNames.append( id.className().toLatin1() );
+        }
+
     }
 
     //_____________________________________________________________
@@ -488,29 +527,30 @@ namespace Oxygen
         if( !widget ) return false;
 
         // accepted default types
+        const WidgetTraits traits( WidgetTraits::get( widget ) );
         if(
-            ( qobject_cast<QDialog*>( widget ) && widget->isWindow() ) ||
-            ( qobject_cast<QMainWindow*>( widget ) && widget->isWindow() ) ||
-            qobject_cast<QGroupBox*>( widget ) )
+            ( traits.is( WidgetTraits::Dialog ) && widget->isWindow() ) ||
+            ( traits.is( WidgetTraits::MainWindow ) && widget->isWindow() ) ||
+            traits.is( WidgetTraits::GroupBox ) )
         { return true; }
 
         // more accepted types, provided they are not dock widget titles
-        if( ( qobject_cast<QMenuBar*>( widget ) ||
-            qobject_cast<QTabBar*>( widget ) ||
-            qobject_cast<QStatusBar*>( widget ) ||
-            qobject_cast<QToolBar*>( widget ) ) &&
+        if( ( traits.is( WidgetTraits::MenuBar ) ||
+            traits.is( WidgetTraits::TabBar ) ||
+            traits.is( WidgetTraits::StatusBar ) ||
+            traits.is( WidgetTraits::ToolBar ) ) &&
             !isDockWidgetTitle( widget ) )
         { return true; }
 
-        if( widget->inherits( "KScreenSaver" ) && widget->inherits( "KCModule" ) )
+        if( traits.is( WidgetTraits::KScreenSaver ) && traits.is( WidgetTraits::KCModule ) )
         { return true; }
 
         if( isWhiteListed( widget ) )
         { return true; }
 
         // flat toolbuttons
-        if( QToolButton* toolButton = qobject_cast<QToolButton*>( widget ) )
-        { if( toolButton->autoRaise() ) return true; }
+        if( traits.is( WidgetTraits::ToolButton ) )
+        { if( static_cast<QToolButton*>( widget )->autoRaise() ) return true; }
 
         // viewports
         /*
@@ -519,25 +559,26 @@ namespace Oxygen
         2/ it matches its parent viewport
         3/ the parent is not blacklisted
         */
-        if( QListView* listView = qobject_cast<QListView*>( widget->parentWidget() ) )
-        { if( listView->viewport() == widget && !isBlackListed( listView ) ) return true; }
-
-        if( QTreeView* treeView = qobject_cast<QTreeView*>( widget->parentWidget() ) )
-        { if( treeView->viewport() == widget && !isBlackListed( treeView ) ) return true; }
+        QWidget* parent( widget->parentWidget() );
+        const WidgetTraits parentTraits( WidgetTraits::get( parent ) );
+        if( parentTraits.is( WidgetTraits::ListView ) || parentTraits.is( WidgetTraits::TreeView ) )
+        {
+            QAbstractItemView* itemView( static_cast<QAbstractItemView*>( parent ) );
+            if( itemView->viewport() == widget && !isBlackListed( itemView ) ) return true;
+        }
 
         /*
         catch labels in status bars.
         this is because of kstatusbar
         who captures buttonPress/release events
         */
-        if( QLabel* label = qobject_cast<QLabel*>( widget ) )
+        if( traits.is( WidgetTraits::Label ) )
         {
-            if( label->textInteractionFlags().testFlag( Qt::TextSelectableByMouse ) ) return false;
+            if( static_cast<QLabel*>( widget )->textInteractionFlags().testFlag( Qt::TextSelectableByMouse ) ) return false;
 
-            QWidget* parent = label->parentWidget();
             while( parent )
             {
-                if( qobject_cast<QStatusBar*>( parent ) ) return true;
+                if( WidgetTraits::get( parent ).is( WidgetTraits::StatusBar ) ) return true;
                 parent = parent->parentWidget();
             }
         }
@@ -554,36 +595,45 @@ namespace Oxygen
         QVariant propertyValue( widget->property( PropertyNames::noWindowGrab ) );
         if( propertyValue.isValid() && propertyValue.toBool() ) return true;
 
-        // list-based blacklisted widgets
-        QString appName( qApp->applicationName() );
-        for ( const ExceptionId &id : std::as_const(_blackList) )
+        // all classes blacklisted for this application: disable the grabbing entirely
+        if( _blackListAll )
         {
-            if( !id.appName().isEmpty() && id.appName() != appName ) continue;
-            if( id.className() == QStringLiteral( "*" ) && !id.appName().isEmpty() )
-            {
-                // if application name matches and all classes are selected
-                // disable the grabbing entirely
-                setEnabled( false );
-                return true;
-            }
-            if( widget->inherits( id.className().toLatin1().data() ) ) return true;
+            setEnabled( false );
+            return true;
         }
 
-        return false;
+        // list-based blacklisted widgets
+        return exceptionVerdict( widget ) & BlackListed;
     }
 
     //_____________________________________________________________
     bool WindowManager::isWhiteListed( QWidget* widget ) const
+    { return exceptionVerdict( widget ) & WhiteListed; }
+
+    //_____________________________________________________________
+    int WindowManager::exceptionVerdict( const QWidget* widget ) const
     {
 
-        QString appName( qApp->applicationName() );
-        for ( const ExceptionId &id : std::as_const(_whiteList) )
+        const QMetaObject* metaObject( widget->metaObject() );
+        auto iter( _exceptionVerdicts.constFind( metaObject ) );
+        if( iter != _exceptionVerdicts.constEnd() ) return iter.value();
+
+        // same as QObject::inherits, for all list entries at once
+        int verdict( 0 );
+        for( const QMetaObject* current = metaObject; current; current = current->superClass() )
         {
-            if( !id.appName().isEmpty() && id.appName() != appName ) continue;
-            if( widget->inherits( id.className().toLatin1().data() ) ) return true;
+            const char* className( current->className() );
+
+            for( const QByteArray& name : std::as_const(_whiteListClassNames) )
+            { if( name == className ) verdict |= WhiteListed; }
+
+            for( const QByteArray& name : std::as_const(_blackListClassNames) )
+            { if( name == className ) verdict |= BlackListed; }
         }
 
-        return false;
+        _exceptionVerdicts.insert( metaObject, verdict );
+        return verdict;
+
     }
 
     //_____________________________________________________________
@@ -6,15 +6,19 @@
  */
 
 #include "oxygen.h"
+#include "oxygeneventdispatcher.h"
 #include "config-liboxygen.h"
 
 #include <QEvent>
 
 #include <QBasicTimer>
+#include <QByteArray>
+#include <QHash>
 #include <QObject>
 #include <QQuickItem>
 #include <QSet>
 #include <QString>
+#include <QVector>
 #include <QWidget>
 
 #if OXYGEN_HAVE_KWAYLAND
@@ -65,6 +69,9 @@ namespace Oxygen
 
         private:
 
+        //* events handled by the event filter
+        static EventDispatcher::EventTypes mouseEvents( void );
+
         //* mouse press event
         bool mousePressEvent( QObject*, QEvent* );
 
@@ -123,6 +130,13 @@ namespace Oxygen
         */
         void initializeBlackList( void );
 
+        //* resolve white and black lists against current application name
+        /**
+        lists are reduced to the class names that apply to this application,
+        and verdicts for each class are then cached on first use
+        */
+        void resolveExceptions( void );
+
         //* initializes the Wayland specific parts
         void initializeWayland();
 
@@ -140,6 +154,16 @@ namespace Oxygen
         //* returns true if widget is dragable
         bool isWhiteListed( QWidget* ) const;
 
+        //* exception verdict
+        enum ExceptionVerdict
+        {
+            WhiteListed = 1<<0,
+            BlackListed = 1<<1
+        };
+
+        //* white and black list verdicts for a given widget class
+        int exceptionVerdict( const QWidget* ) const;
+
         //* returns true if drag can be started from current widget
         bool canDrag( QWidget* );
 
@@ -237,6 +261,18 @@ namespace Oxygen
         */
         ExceptionSet _blackList;
 
+        //* white listed class names that apply to this application
+        QVector<QByteArray> _whiteListClassNames;
+
+        //* black listed class names that apply to this application
+        QVector<QByteArray> _blackListClassNames;
+
+        //* true if all classes are black listed for this application
+        bool _blackListAll;
+
+        //* white and black list verdicts, per class
+        mutable QHash<const QMetaObject*, int> _exceptionVerdicts;
+
         //* drag point
         QPoint _dragPoint;
         QPoint _globalDragPoint;
@@ -11,6 +11,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygencomboboxdata.h"
+#include "oxygeneventdispatcher.h"
 
 namespace Oxygen
 {
@@ -20,7 +21,7 @@ namespace Oxygen
         TransitionData( parent, target, duration ),
         _target( target )
     {
-        _target.data()->installEventFilter( this );
+        EventDispatcher::instance().subscribe( _target.data(), this, { QEvent::Show, QEvent::Resize, QEvent::Move } );
         connect( _target.data(), SIGNAL(destroyed()), SLOT(targetDestroyed()) );
         connect( _target.data(), SIGNAL(currentIndexChanged(int)), SLOT(indexChanged()) );
     }
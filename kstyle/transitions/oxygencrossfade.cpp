@@ -0,0 +1,293 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygencrossfade.cpp
+// single pass crossfade of premultiplied images
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygencrossfade.h"
+
+#include <QtGlobal>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define OXYGEN_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined( OXYGEN_HAVE_SSE2 ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define OXYGEN_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define OXYGEN_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace Oxygen
+{
+
+    namespace
+    {
+
+        //* blend count pixels, with end weight in [0,256]. End may be null
+        using BlendFunction = void (*)( const quint32* start, const quint32* end, quint32* target, int count, int weight );
+
+        //_______________________________________________________
+        void blendScalar( const quint32* start, const quint32* end, quint32* target, int count, int weight )
+        {
+
+            // two channels at a time: each 16 bits slot holds at most 255*256 + 128
+            const quint32 startWeight( 256 - weight );
+            for( int i = 0; i < count; ++i )
+            {
+
+                const quint32 source( start[i] );
+                const quint32 destination( end ? end[i] : 0 );
+
+                const quint32 redBlue( ( ( ( source & 0xff00ff )*startWeight + ( destination & 0xff00ff )*weight + 0x800080 ) >> 8 ) & 0xff00ff );
+                const quint32 alphaGreen( ( ( ( source >> 8 ) & 0xff00ff )*startWeight + ( ( destination >> 8 ) & 0xff00ff )*weight + 0x800080 ) & 0xff00ff00 );
+                target[i] = redBlue | alphaGreen;
+
+            }
+
+        }
+
+        #ifdef OXYGEN_HAVE_SSE2
+        //_______________________________________________________
+        void blendSSE2( const quint32* start, const quint32* end, quint32* target, int count, int weight )
+        {
+
+            const __m128i zero( _mm_setzero_si128() );
+            const __m128i startWeight( _mm_set1_epi16( short( 256 - weight ) ) );
+            const __m128i endWeight( _mm_set1_epi16( short( weight ) ) );
+            const __m128i half( _mm_set1_epi16( 128 ) );
+
+            // four pixels at a time, unpacked to 16 bits per channel
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+
+                const __m128i source( _mm_loadu_si128( reinterpret_cast<const __m128i*>( start + i ) ) );
+                const __m128i destination( end ? _mm_loadu_si128( reinterpret_cast<const __m128i*>( end + i ) ) : zero );
+
+                __m128i low( _mm_add_epi16(
+                    _mm_mullo_epi16( _mm_unpacklo_epi8( source, zero ), startWeight ),
+                    _mm_mullo_epi16( _mm_unpacklo_epi8( destination, zero ), endWeight ) ) );
+
+                __m128i high( _mm_add_epi16(
+                    _mm_mullo_epi16( _mm_unpackhi_epi8( source, zero ), startWeight ),
+                    _mm_mullo_epi16( _mm_unpackhi_epi8( destination, zero ), endWeight ) ) );
+
+                low = _mm_srli_epi16( _mm_add_epi16( low, half ), 8 );
+                high = _mm_srli_epi16( _mm_add_epi16( high, half ), 8 );
+                _mm_storeu_si128( reinterpret_cast<__m128i*>( target + i ), _mm_packus_epi16( low, high ) );
+
+            }
+
+            blendScalar( start + i, end ? end + i : nullptr, target + i, count - i, weight );
+
+        }
+        #endif
+
+        #ifdef OXYGEN_HAVE_AVX2
+        //_______________________________________________________
+        __attribute__(( target( "avx2" ) ))
+        void blendAVX2( const quint32* start, const quint32* end, quint32* target, int count, int weight )
+        {
+
+            const __m256i zero( _mm256_setzero_si256() );
+            const __m256i startWeight( _mm256_set1_epi16( short( 256 - weight ) ) );
+            const __m256i endWeight( _mm256_set1_epi16( short( weight ) ) );
+            const __m256i half( _mm256_set1_epi16( 128 ) );
+
+            // eight pixels at a time. Unpacking and packing both work per 128 bits lane, so pixel order is preserved
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+
+                const __m256i source( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( start + i ) ) );
+                const __m256i destination( end ? _mm256_loadu_si256( reinterpret_cast<const __m256i*>( end + i ) ) : zero );
+
+                __m256i low( _mm256_add_epi16(
+                    _mm256_mullo_epi16( _mm256_unpacklo_epi8( source, zero ), startWeight ),
+                    _mm256_mullo_epi16( _mm256_unpacklo_epi8( destination, zero ), endWeight ) ) );
+
+                __m256i high( _mm256_add_epi16(
+                    _mm256_mullo_epi16( _mm256_unpackhi_epi8( source, zero ), startWeight ),
+                    _mm256_mullo_epi16( _mm256_unpackhi_epi8( destination, zero ), endWeight ) ) );
+
+                low = _mm256_srli_epi16( _mm256_add_epi16( low, half ), 8 );
+                high = _mm256_srli_epi16( _mm256_add_epi16( high, half ), 8 );
+                _mm256_storeu_si256( reinterpret_cast<__m256i*>( target + i ), _mm256_packus_epi16( low, high ) );
+
+            }
+
+            blendSSE2( start + i, end ? end + i : nullptr, target + i, count - i, weight );
+
+        }
+        #endif
+
+        #ifdef OXYGEN_HAVE_NEON
+        //_______________________________________________________
+        void blendNEON( const quint32* start, const quint32* end, quint32* target, int count, int weight )
+        {
+
+            const uint16_t startWeight( 256 - weight );
+            const uint16_t endWeight( weight );
+            const uint8x16_t zero( vdupq_n_u8( 0 ) );
+
+            // four pixels at a time, widened to 16 bits per channel
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+
+                const uint8x16_t source( vld1q_u8( reinterpret_cast<const uint8_t*>( start + i ) ) );
+                const uint8x16_t destination( end ? vld1q_u8( reinterpret_cast<const uint8_t*>( end + i ) ) : zero );
+
+                uint16x8_t low( vmulq_n_u16( vmovl_u8( vget_low_u8( source ) ), startWeight ) );
+                low = vmlaq_n_u16( low, vmovl_u8( vget_low_u8( destination ) ), endWeight );
+
+                uint16x8_t high( vmulq_n_u16( vmovl_u8( vget_high_u8( source ) ), startWeight ) );
+                high = vmlaq_n_u16( high, vmovl_u8( vget_high_u8( destination ) ), endWeight );
+
+                vst1q_u8( reinterpret_cast<uint8_t*>( target + i ), vcombine_u8( vrshrn_n_u16( low, 8 ), vrshrn_n_u16( high, 8 ) ) );
+
+            }
+
+            blendScalar( start + i, end ? end + i : nullptr, target + i, count - i, weight );
+
+        }
+        #endif
+
+        //_______________________________________________________
+        BlendFunction blendFunction( CrossFade::Implementation implementation )
+        {
+            switch( implementation )
+            {
+                #ifdef OXYGEN_HAVE_SSE2
+                case CrossFade::SSE2: return blendSSE2;
+                #endif
+
+                #ifdef OXYGEN_HAVE_AVX2
+                case CrossFade::AVX2: return blendAVX2;
+                #endif
+
+                #ifdef OXYGEN_HAVE_NEON
+                case CrossFade::NEON: return blendNEON;
+                #endif
+
+                default: return blendScalar;
+            }
+        }
+
+        //_______________________________________________________
+        CrossFade::Implementation fastestImplementation( void )
+        {
+            if( CrossFade::isSupported( CrossFade::AVX2 ) ) return CrossFade::AVX2;
+            else if( CrossFade::isSupported( CrossFade::SSE2 ) ) return CrossFade::SSE2;
+            else if( CrossFade::isSupported( CrossFade::NEON ) ) return CrossFade::NEON;
+            else return CrossFade::Scalar;
+        }
+
+    }
+
+    //_______________________________________________________
+    CrossFade::Implementation CrossFade::_implementation = fastestImplementation();
+
+    //_______________________________________________________
+    CrossFade::Implementation CrossFade::implementation( void )
+    { return _implementation; }
+
+    //_______________________________________________________
+    bool CrossFade::setImplementation( Implementation value )
+    {
+        if( !isSupported( value ) ) return false;
+        _implementation = value;
+        return true;
+    }
+
+    //_______________________________________________________
+    bool CrossFade::isSupported( Implementation implementation )
+    {
+        switch( implementation )
+        {
+            case Scalar: return true;
+
+            #ifdef OXYGEN_HAVE_SSE2
+            case SSE2: return true;
+            #endif
+
+            #ifdef OXYGEN_HAVE_AVX2
+            case AVX2:
+            {
+                // may run before static constructors of libgcc
+                __builtin_cpu_init();
+                return __builtin_cpu_supports( "avx2" );
+            }
+            #endif
+
+            #ifdef OXYGEN_HAVE_NEON
+            case NEON: return true;
+            #endif
+
+            default: return false;
+        }
+    }
+
+    //_______________________________________________________
+    const char* CrossFade::name( Implementation implementation )
+    {
+        switch( implementation )
+        {
+            case SSE2: return "sse2";
+            case AVX2: return "avx2";
+            case NEON: return "neon";
+            default: return "scalar";
+        }
+    }
+
+    //_______________________________________________________
+    bool CrossFade::isSupported( const QImage& image )
+    {
+        switch( image.format() )
+        {
+            // opaque pixels are valid premultiplied pixels
+            case QImage::Format_RGB32:
+            case QImage::Format_ARGB32_Premultiplied:
+            return true;
+
+            default: return false;
+        }
+    }
+
+    //_______________________________________________________
+    void CrossFade::blend( const QImage& start, const QImage& end, QImage& target, qreal opacity, const QRect& rect )
+    {
+
+        if( start.isNull() ) return;
+
+        if( target.size() != start.size() || target.format() != QImage::Format_ARGB32_Premultiplied )
+        { target = QImage( start.size(), QImage::Format_ARGB32_Premultiplied ); }
+
+        const QRect local( rect & target.rect() );
+        if( local.isEmpty() ) return;
+
+        const int weight( qBound( 0, qRound( opacity*256 ), 256 ) );
+        const BlendFunction function( blendFunction( _implementation ) );
+        for( int y = local.top(); y <= local.bottom(); ++y )
+        {
+
+            const quint32* startLine( reinterpret_cast<const quint32*>( start.constScanLine( y ) ) + local.left() );
+            const quint32* endLine( end.isNull() ? nullptr : reinterpret_cast<const quint32*>( end.constScanLine( y ) ) + local.left() );
+            quint32* targetLine( reinterpret_cast<quint32*>( target.scanLine( y ) ) + local.left() );
+            function( startLine, endLine, targetLine, local.width(), weight );
+
+        }
+
+    }
+
+}
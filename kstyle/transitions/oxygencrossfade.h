@@ -0,0 +1,72 @@
+#ifndef oxygencrossfade_h
+#define oxygencrossfade_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygencrossfade.h
+// single pass crossfade of premultiplied images
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QImage>
+#include <QRect>
+
+namespace Oxygen
+{
+
+    //* single pass crossfade of premultiplied images
+    /**
+    computes start*(1-opacity) + end*opacity for each pixel of a rect in one pass,
+    using the widest vector unit available at runtime (AVX2, SSE2, NEON) or a scalar loop.
+    A null end image is treated as fully transparent, which fades out start
+    */
+    class CrossFade
+    {
+
+        public:
+
+        //* implementation
+        enum Implementation
+        {
+            Scalar,
+            SSE2,
+            AVX2,
+            NEON
+        };
+
+        //* implementation used by blend. Defaults to the fastest one supported
+        static Implementation implementation( void );
+
+        //* force implementation. Returns false if not supported by this CPU
+        static bool setImplementation( Implementation );
+
+        //* true if implementation is supported by this CPU
+        static bool isSupported( Implementation );
+
+        //* implementation name
+        static const char* name( Implementation );
+
+        //* true if image can be used as blend input
+        /** premultiplied ARGB32 and RGB32 images are supported */
+        static bool isSupported( const QImage& );
+
+        //* blend start and end into target, within rect
+        /**
+        start and end, when not null, must be supported and have the same size as target.
+        Target is converted to premultiplied ARGB32 if needed
+        */
+        static void blend( const QImage& start, const QImage& end, QImage& target, qreal opacity, const QRect& );
+
+        private:
+
+        //* implementation
+        static Implementation _implementation;
+
+    };
+
+}
+
+#endif
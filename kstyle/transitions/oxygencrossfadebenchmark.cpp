@@ -0,0 +1,162 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygencrossfadebenchmark.cpp
+// measure transition frame rendering, painter based versus single pass crossfade
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygencrossfade.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QTextStream>
+
+namespace
+{
+
+    //* opaque page, as grabbed from a stacked widget
+    QImage createPage( const QSize& size, const QColor& first, const QColor& second )
+    {
+        QImage image( size, QImage::Format_ARGB32_Premultiplied );
+        QPainter painter( &image );
+        QLinearGradient gradient( 0, 0, size.width(), size.height() );
+        gradient.setColorAt( 0, first );
+        gradient.setColorAt( 1, second );
+        painter.fillRect( image.rect(), gradient );
+        return image;
+    }
+
+    //* TransitionWidget::fade, as done before the single pass crossfade
+    void fade( const QImage& source, QImage& target, qreal opacity, const QRect& rect )
+    {
+        target.fill( Qt::transparent );
+        QPainter p( &target );
+        p.setClipRect( rect );
+        p.drawImage( QPoint(), source );
+        p.setCompositionMode( QPainter::CompositionMode_DestinationIn );
+        QColor color( Qt::black );
+        color.setAlphaF( opacity );
+        p.fillRect( rect, color );
+    }
+
+    //* stacked widget frame: fade start out over the new page
+    void stackedWidgetFrame( const QImage& start, QImage& local, QImage& window, qreal opacity, const QRect& rect )
+    {
+        fade( start, local, 1.0 - opacity, rect );
+        QPainter p( &window );
+        p.setClipRect( rect );
+        p.drawImage( QPoint(), local );
+    }
+
+    //* generic frame: fade end in, draw faded start over it, then copy to window
+    void crossFadeFrame( const QImage& start, const QImage& end, QImage& local, QImage& current, QImage& window, qreal opacity, const QRect& rect )
+    {
+        current.fill( Qt::transparent );
+        QPainter p( &current );
+        p.setClipRect( rect );
+        p.drawImage( QPoint(), end );
+        fade( start, local, 1.0 - opacity, rect );
+        p.drawImage( QPoint(), local );
+        p.end();
+
+        QPainter windowPainter( &window );
+        windowPainter.setClipRect( rect );
+        windowPainter.drawImage( QPoint(), current );
+    }
+
+    //* single pass frame. A null end fades start out over the window
+    void singlePassFrame( const QImage& start, const QImage& end, QImage& current, QImage& window, qreal opacity, const QRect& rect )
+    {
+        Oxygen::CrossFade::blend( start, end, current, opacity, rect );
+        QPainter p( &window );
+        p.setClipRect( rect );
+        p.drawImage( rect.topLeft(), current, rect );
+    }
+
+    //* print timing
+    void print( QTextStream& out, const QString& label, qint64 nsecs, int frames )
+    { out << label << ": " << nsecs/1000 << " us (" << nsecs/frames/1000 << " us per frame)" << "\n"; }
+
+    //* opacity for a given frame, excluding both ends, where no blending occurs
+    qreal opacity( int frame, int frames )
+    { return qreal( frame + 1 )/( frames + 1 ); }
+
+}
+
+//__________________________________________
+int main( int argc, char** argv )
+{
+
+    QCoreApplication app( argc, argv );
+    app.setApplicationName( QStringLiteral( "oxygen-crossfade-benchmark" ) );
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption framesOption( QStringLiteral( "frames" ), QStringLiteral( "number of frames per transition" ), QStringLiteral( "count" ), QStringLiteral( "60" ) );
+    const QCommandLineOption transitionsOption( QStringLiteral( "transitions" ), QStringLiteral( "number of transitions" ), QStringLiteral( "count" ), QStringLiteral( "10" ) );
+    const QCommandLineOption widthOption( QStringLiteral( "width" ), QStringLiteral( "transition width" ), QStringLiteral( "pixels" ), QStringLiteral( "1920" ) );
+    const QCommandLineOption heightOption( QStringLiteral( "height" ), QStringLiteral( "transition height" ), QStringLiteral( "pixels" ), QStringLiteral( "1080" ) );
+    parser.addOption( framesOption );
+    parser.addOption( transitionsOption );
+    parser.addOption( widthOption );
+    parser.addOption( heightOption );
+    parser.process( app );
+
+    const int frames( qMax( 1, parser.value( framesOption ).toInt() ) );
+    const int transitions( qMax( 1, parser.value( transitionsOption ).toInt() ) );
+    const QSize size( qMax( 1, parser.value( widthOption ).toInt() ), qMax( 1, parser.value( heightOption ).toInt() ) );
+    const QRect rect( QPoint(), size );
+    const int totalFrames( frames*transitions );
+
+    const QImage start( createPage( size, Qt::white, QColor( 0x3daee9 ) ) );
+    const QImage end( createPage( size, QColor( 0x31363b ), Qt::white ) );
+    QImage window( end );
+    QImage local( size, QImage::Format_ARGB32_Premultiplied );
+    QImage current( size, QImage::Format_ARGB32_Premultiplied );
+
+    QTextStream out( stdout );
+    out
+        << "size: " << size.width() << "x" << size.height() << "\n"
+        << "frames: " << totalFrames << "\n";
+
+    QElapsedTimer timer;
+
+    // stacked widget transitions paint the faded start page over the new one
+    timer.start();
+    for( int i = 0; i < totalFrames; ++i )
+    { stackedWidgetFrame( start, local, window, opacity( i%frames, frames ), rect ); }
+    print( out, QStringLiteral( "stacked widget, painter" ), timer.nsecsElapsed(), totalFrames );
+
+    for( int implementation = Oxygen::CrossFade::Scalar; implementation <= Oxygen::CrossFade::NEON; ++implementation )
+    {
+        if( !Oxygen::CrossFade::setImplementation( Oxygen::CrossFade::Implementation( implementation ) ) ) continue;
+        timer.restart();
+        for( int i = 0; i < totalFrames; ++i )
+        { singlePassFrame( start, QImage(), current, window, opacity( i%frames, frames ), rect ); }
+        print( out, QStringLiteral( "stacked widget, %1" ).arg( QLatin1String( Oxygen::CrossFade::name( Oxygen::CrossFade::implementation() ) ) ), timer.nsecsElapsed(), totalFrames );
+    }
+
+    // other transitions blend start and end pixmaps, then copy the result to the window
+    timer.restart();
+    for( int i = 0; i < totalFrames; ++i )
+    { crossFadeFrame( start, end, local, current, window, opacity( i%frames, frames ), rect ); }
+    print( out, QStringLiteral( "crossfade, painter" ), timer.nsecsElapsed(), totalFrames );
+
+    for( int implementation = Oxygen::CrossFade::Scalar; implementation <= Oxygen::CrossFade::NEON; ++implementation )
+    {
+        if( !Oxygen::CrossFade::setImplementation( Oxygen::CrossFade::Implementation( implementation ) ) ) continue;
+        timer.restart();
+        for( int i = 0; i < totalFrames; ++i )
+        { singlePassFrame( start, end, current, window, opacity( i%frames, frames ), rect ); }
+        print( out, QStringLiteral( "crossfade, %1" ).arg( QLatin1String( Oxygen::CrossFade::name( Oxygen::CrossFade::implementation() ) ) ), timer.nsecsElapsed(), totalFrames );
+    }
+
+    return 0;
+
+}
@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenlabeldata.h"
+#include "oxygeneventdispatcher.h"
 
 #include <QEvent>
 #include <QTextStream>
@@ -25,7 +26,7 @@ namespace Oxygen
         TransitionData( parent, target, duration ),
         _target( target )
     {
-        _target.data()->installEventFilter( this );
+        EventDispatcher::instance().subscribe( _target.data(), this, { QEvent::Show, QEvent::Paint } );
 
         const bool hasProxy( _target.data()->graphicsProxyWidget() );
         const bool hasMessageWidget( hasParent( target, "KMessageWidget" ) );
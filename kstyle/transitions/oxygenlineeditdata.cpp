@@ -11,6 +11,8 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenlineeditdata.h"
+#include "oxygeneventdispatcher.h"
+#include "oxygenpixmappool.h"
 
 #include <QEvent>
 #include <QDateTimeEdit>
@@ -33,7 +35,7 @@ namespace Oxygen
         _hasClearButton( false ),
         _edited( false )
     {
-        _target.data()->installEventFilter( this );
+        EventDispatcher::instance().subscribe( _target.data(), this, { QEvent::Show, QEvent::Resize, QEvent::Move } );
 
         checkClearButton();
 
@@ -201,7 +203,7 @@ namespace Oxygen
           // if label geometry has changed since last animation
           // one must clone the pixmap to make it match the right
           // geometry before starting the animation.
-          QPixmap pixmap( current.size() );
+          QPixmap pixmap( PixmapPool::instance().acquire( current.size() ) );
           pixmap.fill( Qt::transparent );
           QPainter p( &pixmap );
           p.drawPixmap( _widgetRect.topLeft() - current.topLeft(), transition().data()->currentPixmap() );
@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenpixmappool.cpp
+// recycles pixmap buffers used by transitions
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenpixmappool.h"
+
+#include <QCoreApplication>
+#include <QPointer>
+#include <QTimerEvent>
+
+namespace Oxygen
+{
+
+    //* default max cost, in bytes. Enough for a couple of full-screen transitions
+    static const qint64 pixmapPoolMaxCost = 64*1024*1024;
+
+    //* delay after which an unused pool is emptied, in milliseconds
+    static const int pixmapPoolIdleDelay = 5000;
+
+    //____________________________________________________________
+    PixmapPool::Key::Key( const QPixmap& pixmap ):
+        _size( pixmap.size() ),
+        _devicePixelRatio( qRound( pixmap.devicePixelRatio()*16 ) )
+    {}
+
+    //____________________________________________________________
+    PixmapPool::Key::Key( const QSize& size, qreal devicePixelRatio ):
+        _size( size ),
+        _devicePixelRatio( qRound( devicePixelRatio*16 ) )
+    {}
+
+    //____________________________________________________________
+    PixmapPool& PixmapPool::instance( void )
+    {
+        // parent to the application, so that pixmaps are freed before the gui is torn down
+        static QPointer<PixmapPool> pool;
+        if( !pool ) pool = new PixmapPool( QCoreApplication::instance() );
+        return *pool;
+    }
+
+    //____________________________________________________________
+    PixmapPool::PixmapPool( QObject* parent ):
+        QObject( parent ),
+        _maxCost( pixmapPoolMaxCost )
+    {}
+
+    //____________________________________________________________
+    QPixmap PixmapPool::acquire( const QSize& size, qreal devicePixelRatio )
+    {
+
+        if( !size.isValid() ) return QPixmap();
+
+        // most recently released first
+        const Key key( size, devicePixelRatio );
+        for( int i = _entries.size() - 1; i >= 0; --i )
+        {
+            const Entry& entry( _entries.at( i ) );
+            if( !( entry._key == key && entry._pixmap.isDetached() ) ) continue;
+
+            QPixmap pixmap( entry._pixmap );
+            _totalCost -= cost( pixmap );
+            _entries.removeAt( i );
+            touch();
+            return pixmap;
+
+        }
+
+        QPixmap pixmap( size );
+        pixmap.setDevicePixelRatio( devicePixelRatio );
+        return pixmap;
+
+    }
+
+    //____________________________________________________________
+    void PixmapPool::release( QPixmap& pixmap )
+    {
+
+        if( pixmap.isNull() ) return;
+
+        const qint64 pixmapCost( cost( pixmap ) );
+        if( _maxCost > 0 && pixmapCost <= _maxCost )
+        {
+
+            // the same buffer may be released through several copies
+            const qint64 cacheKey( pixmap.cacheKey() );
+            bool found( false );
+            for( const Entry& entry:_entries )
+            {
+                if( entry._pixmap.cacheKey() != cacheKey ) continue;
+                found = true;
+                break;
+            }
+
+            if( !found )
+            {
+                trim( _maxCost - pixmapCost );
+                _entries.append( Entry( pixmap ) );
+                _totalCost += pixmapCost;
+                touch();
+            }
+
+        }
+
+        pixmap = QPixmap();
+
+    }
+
+    //____________________________________________________________
+    bool PixmapPool::reserve( QPixmap& pixmap, const QSize& size )
+    {
+        if( !pixmap.isNull() && pixmap.size() == size && pixmap.devicePixelRatio() == 1.0 && pixmap.isDetached() ) return false;
+        release( pixmap );
+        pixmap = acquire( size );
+        return true;
+    }
+
+    //____________________________________________________________
+    void PixmapPool::setMaxCost( qint64 value )
+    {
+        _maxCost = value;
+        trim( _maxCost );
+    }
+
+    //____________________________________________________________
+    void PixmapPool::clear( void )
+    {
+        _entries.clear();
+        _totalCost = 0;
+        _timer.stop();
+    }
+
+    //____________________________________________________________
+    void PixmapPool::timerEvent( QTimerEvent* event )
+    {
+        if( event->timerId() == _timer.timerId() ) clear();
+        else QObject::timerEvent( event );
+    }
+
+    //____________________________________________________________
+    qint64 PixmapPool::cost( const QPixmap& pixmap )
+    { return qint64( pixmap.width() )*pixmap.height()*pixmap.depth()/8; }
+
+    //____________________________________________________________
+    void PixmapPool::trim( qint64 value )
+    {
+
+        if( _totalCost <= value ) return;
+
+        // buffers still shared elsewhere cannot be handed out, drop them first
+        for( int i = _entries.size() - 1; i >= 0 && _totalCost > value; --i )
+        {
+            if( _entries.at( i )._pixmap.isDetached() ) continue;
+            _totalCost -= cost( _entries.at( i )._pixmap );
+            _entries.removeAt( i );
+        }
+
+        // then oldest
+        while( _totalCost > value && !_entries.isEmpty() )
+        {
+            _totalCost -= cost( _entries.first()._pixmap );
+            _entries.removeFirst();
+        }
+
+        if( _entries.isEmpty() ) _timer.stop();
+
+    }
+
+    //____________________________________________________________
+    void PixmapPool::touch( void )
+    { _timer.start( pixmapPoolIdleDelay, this ); }
+
+}
@@ -0,0 +1,146 @@
+#ifndef oxygenpixmappool_h
+#define oxygenpixmappool_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenpixmappool.h
+// recycles pixmap buffers used by transitions
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include <QBasicTimer>
+#include <QList>
+#include <QObject>
+#include <QPixmap>
+
+namespace Oxygen
+{
+
+    //* recycles pixmap buffers used by transitions
+    /**
+    pixmaps released to the pool are bucketed by size and device pixel ratio, and handed back
+    on the next request for the same bucket, provided nobody else still shares them.
+    The pool holds at most maxCost bytes, and is emptied once it has not been used for a while,
+    so that steady state transitions do not allocate, while idle applications keep no buffers around
+    */
+    class PixmapPool: public QObject
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //* shared pool
+        static PixmapPool& instance( void );
+
+        //* returns a pixmap of given size and device pixel ratio. Content is undefined
+        QPixmap acquire( const QSize&, qreal devicePixelRatio = 1.0 );
+
+        //* give pixmap back to the pool. Pixmap is reset
+        void release( QPixmap& );
+
+        //* make sure pixmap is a buffer of given size that is not shared with anybody else
+        /** the previous buffer is given back to the pool. Returns true if the buffer changed, in which case content is undefined */
+        bool reserve( QPixmap&, const QSize& );
+
+        //* max cost, in bytes
+        void setMaxCost( qint64 value );
+
+        //* max cost, in bytes
+        qint64 maxCost( void ) const
+        { return _maxCost; }
+
+        //* total cost of pooled pixmaps, in bytes
+        qint64 totalCost( void ) const
+        { return _totalCost; }
+
+        //* number of pooled pixmaps
+        int size( void ) const
+        { return _entries.size(); }
+
+        //* remove all pixmaps
+        void clear( void );
+
+        protected:
+
+        //* timer event
+        void timerEvent( QTimerEvent* ) override;
+
+        private:
+
+        //* constructor
+        explicit PixmapPool( QObject* );
+
+        //* bucket
+        class Key
+        {
+            public:
+
+            //* constructor
+            explicit Key( const QPixmap& );
+
+            //* constructor
+            Key( const QSize&, qreal );
+
+            //* equal to operator
+            bool operator == ( const Key& other ) const
+            { return _size == other._size && _devicePixelRatio == other._devicePixelRatio; }
+
+            private:
+
+            //* physical size
+            QSize _size;
+
+            //* device pixel ratio, times 16
+            int _devicePixelRatio = 16;
+
+        };
+
+        //* pooled pixmap
+        class Entry
+        {
+            public:
+
+            //* constructor
+            explicit Entry( const QPixmap& pixmap ):
+                _key( pixmap ),
+                _pixmap( pixmap )
+            {}
+
+            //* bucket
+            Key _key;
+
+            //* pixmap
+            QPixmap _pixmap;
+
+        };
+
+        //* pixmap cost, in bytes
+        static qint64 cost( const QPixmap& );
+
+        //* remove oldest entries until total cost fits
+        void trim( qint64 );
+
+        //* restart idle timer
+        void touch( void );
+
+        //* pooled pixmaps, oldest first
+        QList<Entry> _entries;
+
+        //* max cost
+        qint64 _maxCost;
+
+        //* total cost
+        qint64 _totalCost = 0;
+
+        //* idle timer
+        QBasicTimer _timer;
+
+    };
+
+}
+
+#endif
@@ -11,8 +11,10 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygentransitions.h"
+#include "oxygenpixmappool.h"
 #include "oxygenpropertynames.h"
 #include "oxygenstyleconfigdata.h"
+#include "oxygenwidgettraits.h"
 
 namespace Oxygen
 {
@@ -29,6 +31,22 @@ namespace Oxygen
 
     }
 
+    //________________________________________________________--
+    void Transitions::memoryFootprint( MemoryFootprint& footprint ) const
+    {
+
+        const QString category( QStringLiteral( "transitions" ) );
+        footprint.add( category, QStringLiteral( "comboBox" ), _comboBoxEngine->dataCount() );
+        footprint.add( category, QStringLiteral( "label" ), _labelEngine->dataCount() );
+        footprint.add( category, QStringLiteral( "lineEdit" ), _lineEditEngine->dataCount() );
+        footprint.add( category, QStringLiteral( "stackedWidget" ), _stackedWidgetEngine->dataCount() );
+
+        // pixmaps kept for reuse by the next transition
+        const PixmapPool& pool( PixmapPool::instance() );
+        footprint.add( category, QStringLiteral( "pixmapPool" ), pool.size(), pool.totalCost() );
+
+    }
+
     //________________________________________________________--
     void Transitions::setupEngines( void )
     {
@@ -64,24 +82,25 @@ namespace Oxygen
         if( propertyValue.isValid() && propertyValue.toBool() ) return;
 
 
-        if( QLabel* label = qobject_cast<QLabel*>( widget ) ) {
+        const WidgetTraits traits( WidgetTraits::get( widget ) );
+        if( traits.is( WidgetTraits::Label ) ) {
 
             // do not animate labels from tooltips
             if( widget->window() && widget->window()->windowFlags().testFlag( Qt::ToolTip ) ) return;
-            else if( widget->window() && widget->window()->inherits( "KWin::GeometryTip" ) ) return;
-            else labelEngine().registerWidget( label );
+            else if( WidgetTraits::get( widget->window() ).is( WidgetTraits::KWinGeometryTip ) ) return;
+            else labelEngine().registerWidget( static_cast<QLabel*>( widget ) );
 
-        } else if( QComboBox* comboBox = qobject_cast<QComboBox*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::ComboBox ) ) {
 
-            comboBoxEngine().registerWidget( comboBox );
+            comboBoxEngine().registerWidget( static_cast<QComboBox*>( widget ) );
 
-        } else if( QLineEdit* lineEdit = qobject_cast<QLineEdit*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::LineEdit ) ) {
 
-            lineEditEngine().registerWidget( lineEdit );
+            lineEditEngine().registerWidget( static_cast<QLineEdit*>( widget ) );
 
-        } else if( QStackedWidget* stack = qobject_cast<QStackedWidget*>( widget ) ) {
+        } else if( traits.is( WidgetTraits::StackedWidget ) ) {
 
-            stackedWidgetEngine().registerWidget( stack );
+            stackedWidgetEngine().registerWidget( static_cast<QStackedWidget*>( widget ) );
 
         }
 
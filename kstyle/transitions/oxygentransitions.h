@@ -14,6 +14,7 @@
 #include "oxygencomboboxengine.h"
 #include "oxygenlabelengine.h"
 #include "oxygenlineeditengine.h"
+#include "oxygenmemoryfootprint.h"
 #include "oxygenstackedwidgetengine.h"
 
 namespace Oxygen
@@ -36,6 +37,9 @@ namespace Oxygen
         /** unregister all animations associated to a widget */
         void unregisterWidget( QWidget* widget ) const;
 
+        //* add number of data objects per engine to report
+        void memoryFootprint( MemoryFootprint& ) const;
+
         //* qlabel engine
         ComboBoxEngine& comboBoxEngine( void ) const
         { return *_comboBoxEngine; }
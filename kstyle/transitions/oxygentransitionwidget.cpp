@@ -9,6 +9,9 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygentransitionwidget.h"
+#include "oxygencrossfade.h"
+#include "oxygenmemoryfootprint.h"
+#include "oxygenpixmappool.h"
 
 #include <QPainter>
 #include <QPaintEvent>
@@ -38,11 +41,86 @@ namespace Oxygen
         // setup animation
         _animation.data()->setStartValue( 0 );
         _animation.data()->setEndValue( 1.0 );
-        _animation.data()->setTargetObject( this );
-        _animation.data()->setPropertyName( "opacity" );
+        _animation.data()->setTarget( this, &TransitionWidget::setOpacity );
 
-        // hide when animation is finished
+        // hide when animation is finished, and release crossfade output
         connect( _animation.data(), SIGNAL(finished()), SLOT(hide()) );
+        connect( _animation.data(), &Animation::finished, this, &TransitionWidget::releaseCurrentImage );
+
+    }
+
+    //________________________________________________
+    TransitionWidget::~TransitionWidget( void )
+    {
+        // give buffers back to the pool
+        PixmapPool& pool( PixmapPool::instance() );
+        pool.release( _startPixmap );
+        pool.release( _localStartPixmap );
+        pool.release( _endPixmap );
+        pool.release( _currentPixmap );
+    }
+
+    //________________________________________________
+    void TransitionWidget::setStartPixmap( QPixmap pixmap )
+    {
+        PixmapPool::instance().release( _startPixmap );
+        _startPixmap = pixmap;
+    }
+
+    //________________________________________________
+    void TransitionWidget::setEndPixmap( QPixmap pixmap )
+    {
+        PixmapPool& pool( PixmapPool::instance() );
+        pool.release( _endPixmap );
+        pool.release( _currentPixmap );
+        _endPixmap = pixmap;
+        _currentPixmap = pixmap;
+        _currentImageDirty = false;
+    }
+
+    //________________________________________________
+    qint64 TransitionWidget::bufferBytes( void ) const
+    {
+        return
+            MemoryFootprint::bytes( _startPixmap ) +
+            MemoryFootprint::bytes( _localStartPixmap ) +
+            MemoryFootprint::bytes( _endPixmap ) +
+            MemoryFootprint::bytes( _currentPixmap ) +
+            MemoryFootprint::bytes( _currentImage );
+    }
+
+    //________________________________________________
+    void TransitionWidget::hideEvent( QHideEvent* event )
+    {
+        releaseCurrentImage();
+        QWidget::hideEvent( event );
+    }
+
+    //________________________________________________
+    void TransitionWidget::releaseCurrentImage( void )
+    {
+
+        if( _currentImage.isNull() ) return;
+
+        // keep last frame available as current pixmap
+        if( _currentImageDirty ) currentPixmap();
+        _currentImage = QImage();
+
+    }
+
+    //________________________________________________
+    const QPixmap& TransitionWidget::currentPixmap( void ) const
+    {
+
+        // only needed when an animation is interrupted
+        if( _currentImageDirty )
+        {
+            PixmapPool::instance().release( _currentPixmap );
+            _currentPixmap = QPixmap::fromImage( _currentImage );
+            _currentImageDirty = false;
+        }
+
+        return _currentPixmap;
 
     }
 
@@ -54,9 +132,7 @@ namespace Oxygen
         if( !rect.isValid() ) rect = widget->rect();
         if( !rect.isValid() ) return QPixmap();
 
-        // initialize pixmap
-        QPixmap out( rect.size() );
-        out.fill( Qt::transparent );
+        QPixmap out;
         _paintEnabled = false;
 
         if( testFlag( GrabFromWindow ) )
@@ -68,6 +144,10 @@ namespace Oxygen
 
         } else {
 
+            // initialize pixmap
+            out = PixmapPool::instance().acquire( rect.size() );
+            out.fill( Qt::transparent );
+
             if( !testFlag( Transparent ) ) { grabBackground( out, widget, rect ); }
             grabWidget( out, widget, rect );
 
@@ -110,19 +190,22 @@ namespace Oxygen
         QRect rect = event->rect();
         if( !rect.isValid() ) rect = this->rect();
 
+        // single pass crossfade
+        if( crossFade( rect ) ) return;
+
         // local pixmap
         const bool paintOnWidget( testFlag( PaintOnWidget ) && !testFlag( Transparent ) );
         if( !paintOnWidget )
         {
 
-            if( _currentPixmap.isNull() || _currentPixmap.size() != size() )
-            { _currentPixmap = QPixmap( size() ); }
+            // reuse buffer, unless it is still shared with the end pixmap
+            // only the dirty rect gets painted and copied to the widget
+            if( PixmapPool::instance().reserve( _currentPixmap, size() ) ) _currentPixmap.fill( Qt::transparent );
+            else clear( _currentPixmap, rect );
+            _currentImageDirty = false;
 
         }
 
-        // fill
-        _currentPixmap.fill( Qt::transparent );
-
         // copy local pixmap to current
         {
 
@@ -183,6 +266,50 @@ namespace Oxygen
         }
     }
 
+    //________________________________________________
+    bool TransitionWidget::crossFade( const QRect& rect )
+    {
+
+        // nothing to blend
+        if( opacity() < 0.004 || opacity() > 0.996 || _startPixmap.isNull() ) return false;
+
+        // pixmaps must cover the widget, with one to one pixels
+        const auto isValid = [this]( const QPixmap& pixmap )
+        { return pixmap.size() == size() && pixmap.devicePixelRatio() == 1.0; };
+
+        if( !isValid( _startPixmap ) ) return false;
+        if( !( _endPixmap.isNull() || isValid( _endPixmap ) ) ) return false;
+
+        // raster pixmaps share their data with the returned images
+        const QImage start( _startPixmap.toImage() );
+        if( !CrossFade::isSupported( start ) ) return false;
+
+        QImage end;
+        if( !_endPixmap.isNull() )
+        {
+            end = _endPixmap.toImage();
+            if( !CrossFade::isSupported( end ) ) return false;
+        }
+
+        if( _currentImage.size() != size() )
+        {
+            _currentImage = QImage( size(), QImage::Format_ARGB32_Premultiplied );
+            _currentImage.fill( Qt::transparent );
+        }
+
+        // a null end pixmap is transparent, which fades start out over what lies below
+        CrossFade::blend( start, end, _currentImage, opacity(), rect );
+
+        QPainter p( this );
+        p.setClipRect( rect );
+        p.drawImage( rect.topLeft(), _currentImage, rect );
+        p.end();
+
+        _currentImageDirty = !( testFlag( PaintOnWidget ) && !testFlag( Transparent ) );
+        return true;
+
+    }
+
     //________________________________________________
     void TransitionWidget::grabBackground( QPixmap& pixmap, QWidget* widget, QRect& rect ) const
     {
@@ -258,11 +385,9 @@ namespace Oxygen
     void TransitionWidget::fade( const QPixmap& source, QPixmap& target, qreal opacity, const QRect& rect ) const
     {
 
-        if( target.isNull() || target.size() != size() )
-        { target = QPixmap( size() ); }
-
         // erase target
-        target.fill( Qt::transparent );
+        if( PixmapPool::instance().reserve( target, size() ) ) target.fill( Qt::transparent );
+        else clear( target, rect );
 
         // check opacity
         if( opacity*255 < 1 ) return;
@@ -286,4 +411,21 @@ namespace Oxygen
         return;
     }
 
+    //________________________________________________
+    void TransitionWidget::clear( QPixmap& pixmap, const QRect& rect )
+    {
+
+        // pixmaps without alpha channel must be converted first
+        if( !pixmap.hasAlphaChannel() || rect.contains( pixmap.rect() ) )
+        {
+            pixmap.fill( Qt::transparent );
+            return;
+        }
+
+        QPainter p( &pixmap );
+        p.setCompositionMode( QPainter::CompositionMode_Source );
+        p.fillRect( rect, Qt::transparent );
+
+    }
+
 }
@@ -13,6 +13,7 @@
 #include "oxygenanimation.h"
 #include "oxygen.h"
 
+#include <QImage>
 #include <QWidget>
 
 #include <cmath>
@@ -37,6 +38,9 @@ namespace Oxygen
         //* constructor
         TransitionWidget( QWidget* parent, int duration );
 
+        //* destructor
+        ~TransitionWidget( void ) override;
+
         //*@name flags
         //@{
         enum Flag
@@ -102,8 +106,7 @@ namespace Oxygen
         { setStartPixmap( QPixmap() ); }
 
         //* start
-        void setStartPixmap( QPixmap pixmap )
-        { _startPixmap = pixmap; }
+        void setStartPixmap( QPixmap pixmap );
 
         //* start
         const QPixmap& startPixmap( void ) const
@@ -114,19 +117,17 @@ namespace Oxygen
         { setEndPixmap( QPixmap() ); }
 
         //* end
-        void setEndPixmap( QPixmap pixmap )
-        {
-            _endPixmap = pixmap;
-            _currentPixmap = pixmap;
-        }
+        void setEndPixmap( QPixmap pixmap );
 
         //* start
         const QPixmap& endPixmap( void ) const
         { return _endPixmap; }
 
         //* current
-        const QPixmap& currentPixmap( void ) const
-        { return _currentPixmap; }
+        const QPixmap& currentPixmap( void ) const;
+
+        //* bytes held by pixmap buffers
+        qint64 bufferBytes( void ) const;
 
         //@}
 
@@ -159,8 +160,15 @@ namespace Oxygen
         //* paint event
         void paintEvent( QPaintEvent* ) override;
 
+        //* hide event
+        /** the widget is hidden when the animation finishes */
+        void hideEvent( QHideEvent* ) override;
+
         private:
 
+        //* release single pass crossfade output
+        void releaseCurrentImage( void );
+
         //* grab widget background
         /**
         Background is not rendered properly using QWidget::render.
@@ -172,9 +180,16 @@ namespace Oxygen
         //* grab widget
         void grabWidget( QPixmap&, QWidget*, QRect& ) const;
 
+        //* crossfade start and end pixmaps in a single pass, when their format allows
+        /** returns false if the generic, painter based path must be used */
+        bool crossFade( const QRect& );
+
         //* fade pixmap
         void fade( const QPixmap& source, QPixmap& target, qreal opacity, const QRect& ) const;
 
+        //* erase rect in pixmap
+        static void clear( QPixmap&, const QRect& );
+
         //* apply step
         qreal digitize( const qreal& value ) const
         {
@@ -201,7 +216,13 @@ namespace Oxygen
         QPixmap _endPixmap;
 
         //* current pixmap
-        QPixmap _currentPixmap;
+        mutable QPixmap _currentPixmap;
+
+        //* single pass crossfade output
+        QImage _currentImage;
+
+        //* true when current pixmap must be updated from crossfade output
+        mutable bool _currentImageDirty = false;
 
         //* current state opacity
         qreal _opacity = 0;
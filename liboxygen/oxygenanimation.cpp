@@ -9,3 +9,27 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include "oxygenanimation.h"
+
+namespace Oxygen
+{
+
+    //____________________________________________________________
+    void Animation::updateCurrentTime( int time )
+    {
+
+        if( !_target )
+        {
+            stop();
+            return;
+        }
+
+        qreal progress( _duration > 0 ? qreal( time )/_duration : 1.0 );
+        if( _easingCurve.type() != QEasingCurve::Linear ) progress = _easingCurve.valueForProgress( progress );
+
+        _currentValue = _startValue + ( _endValue - _startValue )*progress;
+        if( _setter ) _setter( _currentValue );
+        emit valueChanged( _currentValue );
+
+    }
+
+}
@@ -10,9 +10,11 @@
 // SPDX-License-Identifier: MIT
 //////////////////////////////////////////////////////////////////////////////
 
+#include <QAbstractAnimation>
+#include <QEasingCurve>
 #include <QPointer>
-#include <QPropertyAnimation>
-#include <QVariant>
+
+#include <functional>
 
 #include "oxygen_export.h"
 
@@ -21,7 +23,12 @@
 namespace Oxygen
 {
 
-    class OXYGEN_EXPORT Animation: public QPropertyAnimation
+    //! animate a qreal value between start and end values
+    /*!
+    on every tick the interpolated value is passed directly to a setter, registered with setTarget.
+    Unlike QPropertyAnimation, there is no QVariant boxing and no property lookup through the meta object
+    */
+    class OXYGEN_EXPORT Animation: public QAbstractAnimation
     {
 
         Q_OBJECT
@@ -31,10 +38,14 @@ namespace Oxygen
         //! TimeLine shared pointer
         using Pointer = WeakPointer<Animation>;
 
+        //! setter, called with the interpolated value
+        using Setter = std::function<void( qreal )>;
+
         //! constructor
         Animation( int duration, QObject* parent ):
-            QPropertyAnimation( parent )
-        { setDuration( duration ); }
+            QAbstractAnimation( parent ),
+            _duration( duration )
+        {}
 
         //! true if running
         bool isRunning( void ) const
@@ -47,6 +58,92 @@ namespace Oxygen
             start();
         }
 
+        //! duration
+        int duration( void ) const override
+        { return _duration; }
+
+        //! duration
+        void setDuration( int value )
+        { _duration = qMax( 0, value ); }
+
+        //!@name values
+        //@{
+
+        //! start value
+        qreal startValue( void ) const
+        { return _startValue; }
+
+        //! start value
+        void setStartValue( qreal value )
+        { _startValue = value; }
+
+        //! end value
+        qreal endValue( void ) const
+        { return _endValue; }
+
+        //! end value
+        void setEndValue( qreal value )
+        { _endValue = value; }
+
+        //! last interpolated value
+        qreal currentValue( void ) const
+        { return _currentValue; }
+
+        //@}
+
+        //! easing curve
+        const QEasingCurve& easingCurve( void ) const
+        { return _easingCurve; }
+
+        //! easing curve
+        void setEasingCurve( const QEasingCurve& value )
+        { _easingCurve = value; }
+
+        //! target and setter
+        /*! the animation stops as soon as target is deleted */
+        void setTarget( QObject* target, Setter setter )
+        {
+            _target = target;
+            _setter = std::move( setter );
+        }
+
+        //! target and setter member function
+        template<typename T> void setTarget( T* target, void (T::*setter)( qreal ) )
+        { setTarget( target, [target, setter]( qreal value ) { (target->*setter)( value ); } ); }
+
+        Q_SIGNALS:
+
+        //! emitted after the setter was called with a new value
+        void valueChanged( qreal );
+
+        protected:
+
+        //! interpolate value and pass it to setter
+        void updateCurrentTime( int ) override;
+
+        private:
+
+        //! duration
+        int _duration = 250;
+
+        //! start value
+        qreal _startValue = 0;
+
+        //! end value
+        qreal _endValue = 1;
+
+        //! current value
+        qreal _currentValue = 0;
+
+        //! easing curve
+        QEasingCurve _easingCurve;
+
+        //! target
+        WeakPointer<QObject> _target;
+
+        //! setter
+        Setter _setter;
+
     };
 
 }
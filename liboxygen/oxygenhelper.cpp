@@ -25,6 +25,37 @@
 namespace Oxygen
 {
 
+    //____________________________________________________________________
+    thread_local qreal DevicePixelRatio::_current = 0;
+
+    //____________________________________________________________________
+    qreal DevicePixelRatio::current( void )
+    {
+        if( _current > 0 ) return _current;
+        else return qApp ? qApp->devicePixelRatio():1;
+    }
+
+    //____________________________________________________________________
+    DevicePixelRatio::Scope::Scope( const QPainter* painter ):
+        _previous( _current )
+    {
+        if( painter && painter->device() )
+        { _current = painter->device()->devicePixelRatioF(); }
+    }
+
+    //____________________________________________________________________
+    DevicePixelRatio::Scope::Scope( const QPaintDevice* device ):
+        _previous( _current )
+    {
+        if( device )
+        { _current = device->devicePixelRatioF(); }
+    }
+
+    //____________________________________________________________________
+    DevicePixelRatio::Scope::~Scope( void )
+    { _current = _previous; }
+
+    //____________________________________________________________________
     const qreal Helper::_slabThickness = 0.45;
     const qreal Helper::_shadowGain = 1.5;
     const qreal Helper::_glowBias = 0.6;
@@ -65,6 +96,8 @@ namespace Oxygen
         _backgroundColorCache.clear();
         _backgroundCache.clear();
         _dotCache.clear();
+        _roundedRegionCache.clear();
+        _roundedMaskCache.clear();
     }
 
     //____________________________________________________________________
@@ -74,11 +107,34 @@ namespace Oxygen
         // assign value
         _backgroundCache.setMaxCost( value );
         _dotCache.setMaxCost( value );
+        _roundedRegionCache.setMaxCost( value );
+        _roundedMaskCache.setMaxCost( value );
 
         /* note: we do not limit the size of the color caches on purpose, since they should be small anyway */
 
     }
 
+    //____________________________________________________________________
+    void Helper::memoryFootprint( MemoryFootprint& footprint ) const
+    {
+
+        const QString category( QStringLiteral( "helper" ) );
+        footprint.add( category, QStringLiteral( "background" ), _backgroundCache.usage() );
+        footprint.add( category, QStringLiteral( "dot" ), _dotCache.usage() );
+        footprint.add( category, QStringLiteral( "roundedRegion" ), _roundedRegionCache.usage() );
+        footprint.add( category, QStringLiteral( "roundedMask" ), _roundedMaskCache.usage() );
+
+        // color caches are not limited in size, and only grow with the number of colors in use
+        MemoryFootprint::Usage colors;
+        for( const ColorCache* cache:{
+            &_decoColorCache, &_lightColorCache, &_darkColorCache, &_shadowColorCache,
+            &_backgroundTopColorCache, &_backgroundBottomColorCache, &_backgroundRadialColorCache, &_backgroundColorCache } )
+        { colors += cache->usage(); }
+
+        footprint.add( category, QStringLiteral( "colors" ), colors );
+
+    }
+
     //____________________________________________________________________
     void Helper::renderWindowBackground(QPainter* p, const QRect& clipRect, const QRect& windowRect, const QColor& color, int yShift)
     {
@@ -444,21 +500,36 @@ namespace Oxygen
     //_______________________________________________________________________
     QRegion Helper::roundedMask( const QRect& rect, int left, int right, int top, int bottom ) const
     {
-        // get rect geometry
-        int x, y, w, h;
-        rect.getRect( &x, &y, &w, &h );
+        // only cache regions for the usual on/off corner flags
+        const bool cacheable( !( ( left|right|top|bottom ) & ~1 ) );
+        const MaskKey key( rect.size(), left | ( right<<1 ) | ( top<<2 ) | ( bottom<<3 ) );
+        if( cacheable )
+        {
+            if( const QRegion* cached = _roundedRegionCache.object( key ) )
+            { return cached->translated( rect.topLeft() ); }
+        }
 
-        QRegion mask( x + 4*left, y + 0*top, w-4*( left+right ), h-0*( top+bottom ) );
-        mask += QRegion( x + 0*left, y + 4*top, w-0*( left+right ), h-4*( top+bottom ) );
-        mask += QRegion( x + 2*left, y + 1*top, w-2*( left+right ), h-1*( top+bottom ) );
-        mask += QRegion( x + 1*left, y + 2*top, w-1*( left+right ), h-2*( top+bottom ) );
+        // get rect geometry, at origin
+        const int w( rect.width() );
+        const int h( rect.height() );
 
-        return mask;
+        QRegion mask( 4*left, 0*top, w-4*( left+right ), h-0*( top+bottom ) );
+        mask += QRegion( 0*left, 4*top, w-0*( left+right ), h-4*( top+bottom ) );
+        mask += QRegion( 2*left, 1*top, w-2*( left+right ), h-1*( top+bottom ) );
+        mask += QRegion( 1*left, 2*top, w-1*( left+right ), h-2*( top+bottom ) );
+
+        if( cacheable ) _roundedRegionCache.insert( key, new QRegion( mask ) );
+        return mask.translated( rect.topLeft() );
     }
 
     //______________________________________________________________________________
     QBitmap Helper::roundedMask( const QSize& size, Corners corners, qreal radius ) const
     {
+
+        const MaskKey key( size, corners, radius, DevicePixelRatio::current() );
+        if( const QBitmap* cached = _roundedMaskCache.object( key ) )
+        { return *cached; }
+
         QBitmap bitmap( highDpiPixmap( size ) );
         if( corners == 0 )
         {
@@ -481,6 +552,7 @@ namespace Oxygen
 
         }
 
+        _roundedMaskCache.insert( key, new QBitmap( bitmap ) );
         return bitmap;
     }
 
@@ -763,7 +835,7 @@ namespace Oxygen
     //______________________________________________________________________________________
     QPixmap Helper::highDpiPixmap( int width, int height ) const
     {
-        const qreal dpiRatio( qApp->devicePixelRatio() );
+        const qreal dpiRatio( DevicePixelRatio::current() );
         QPixmap pixmap( width*dpiRatio, height*dpiRatio );
         pixmap.setDevicePixelRatio( dpiRatio );
         return pixmap;
@@ -12,6 +12,7 @@
  * SPDX-License-Identifier: LGPL-2.0-only
  */
 
+#include "oxygenmemoryfootprint.h"
 #include "oxygentileset.h"
 #include "config-liboxygen.h"
 
@@ -23,6 +24,7 @@
 #include <QBitmap>
 #include <QCache>
 #include <QColor>
+#include <QHash>
 #include <QPixmap>
 #include <QQueue>
 #include <QWidget>
@@ -33,17 +35,69 @@
 #include <xcb/xcb.h>
 #endif
 
+class QPaintDevice;
+class QPainter;
+
 namespace Oxygen
 {
 
-    template<typename T> class BaseCache: public QCache<quint64, T>
+    //* device pixel ratio of the paint device currently rendered to
+    /*!
+    device dependent caches are split per ratio, and Helper::highDpiPixmap renders at that ratio.
+    Painting entry points set it from their painter for the duration of the call, using Scope
+    */
+    class OXYGEN_EXPORT DevicePixelRatio
+    {
+
+        public:
+
+        //* current ratio. Falls back to the application ratio outside of any scope
+        static qreal current( void );
+
+        //* current ratio, in 1/16th steps, as used in cache keys
+        static int currentKey( void )
+        { return qRound( current()*16 ); }
+
+        //* use painter's device ratio for the lifetime of the object
+        class OXYGEN_EXPORT Scope
+        {
+
+            public:
+
+            //* constructor
+            explicit Scope( const QPainter* );
+
+            //* constructor
+            explicit Scope( const QPaintDevice* );
+
+            //* destructor
+            ~Scope( void );
+
+            private:
+
+            //* previous value
+            qreal _previous;
+
+            Q_DISABLE_COPY( Scope )
+
+        };
+
+        private:
+
+        //* current value. Zero when unset
+        /*! per thread, since QImage based painting may happen outside of the gui thread */
+        static thread_local qreal _current;
+
+    };
+
+    template<typename T, typename Key = quint64> class BaseCache: public QCache<Key, T>
     {
 
         public:
 
         //* constructor
         BaseCache( int maxCost ):
-            QCache<quint64, T>( maxCost ),
+            QCache<Key, T>( maxCost ),
             _enabled( true )
         {}
 
@@ -65,22 +119,58 @@ namespace Oxygen
         { return _enabled; }
 
         //* access
-        T* object( const quint64& key )
-        { return _enabled ? QCache<quint64, T>::object( key ) : 0; }
+        T* object( const Key& key )
+        { return _enabled ? QCache<Key, T>::object( key ) : 0; }
+
+        //* insert
+        /** bytes held by the value are recorded, so that usage can be reported without accessing cached objects */
+        bool insert( const Key& key, T* value, int cost = 1 )
+        {
+            // drop records of evicted entries once they outnumber live ones
+            if( _bytes.size() > 2*QCache<Key, T>::size() + 16 )
+            {
+                for( auto iter = _bytes.begin(); iter != _bytes.end(); )
+                {
+                    if( QCache<Key, T>::contains( iter.key() ) ) ++iter;
+                    else iter = _bytes.erase( iter );
+                }
+            }
+
+            _bytes.insert( key, MemoryFootprint::bytes( *value ) );
+            return QCache<Key, T>::insert( key, value, cost );
+        }
+
+        //* number of entries and bytes held
+        /**
+        QCache::object marks entries as recently used, so recorded sizes are read instead,
+        in order to leave eviction order untouched
+        */
+        MemoryFootprint::Usage usage( void ) const
+        {
+            MemoryFootprint::Usage out;
+            const auto keys( QCache<Key, T>::keys() );
+            for( const Key& key:keys )
+            {
+                ++out._count;
+                out._bytes += _bytes.value( key );
+            }
+
+            return out;
+        }
 
         //* max cost
         void setMaxCost( int cost )
         {
             if( cost <= 0 ) {
 
-                QCache<quint64, T>::clear();
-                QCache<quint64, T>::setMaxCost( 1 );
+                QCache<Key, T>::clear();
+                QCache<Key, T>::setMaxCost( 1 );
                 setEnabled( false );
 
             } else {
 
                 setEnabled( true );
-                QCache<quint64, T>::setMaxCost( cost );
+                QCache<Key, T>::setMaxCost( cost );
 
             }
         }
@@ -90,6 +180,86 @@ namespace Oxygen
         //* enable flag
         bool _enabled;
 
+        //* bytes held by inserted values
+        QHash<Key, qint64> _bytes;
+
+    };
+
+    //* cache of objects rendered for a given device pixel ratio
+    /*!
+    one BaseCache is kept per ratio, so that screens with different ratios
+    each keep their own hot set rather than evicting each other's
+    */
+    template<typename T, typename Key = quint64> class DevicePixelRatioCache
+    {
+
+        public:
+
+        //* constructor
+        explicit DevicePixelRatioCache( int maxCost = 100 ):
+            _maxCost( maxCost )
+        {}
+
+        //* access
+        T* object( const Key& key )
+        { return current().object( key ); }
+
+        //* insert
+        bool insert( const Key& key, T* value, int cost = 1 )
+        { return current().insert( key, value, cost ); }
+
+        //* clear
+        void clear( void )
+        { for( const auto& cache : std::as_const( _caches ) ) cache->clear(); }
+
+        //* enable
+        void setEnabled( bool value )
+        {
+            _enabled = value;
+            for( const auto& cache : std::as_const( _caches ) ) cache->setEnabled( value );
+        }
+
+        //* max cost, per device pixel ratio
+        void setMaxCost( int cost )
+        {
+            _maxCost = cost;
+            _enabled = cost > 0;
+            for( const auto& cache : std::as_const( _caches ) ) cache->setMaxCost( cost );
+        }
+
+        //* number of entries and bytes held, for all device pixel ratios
+        MemoryFootprint::Usage usage( void ) const
+        {
+            MemoryFootprint::Usage out;
+            for( const auto& cache : std::as_const( _caches ) ) out += cache->usage();
+            return out;
+        }
+
+        private:
+
+        //* cache matching current device pixel ratio
+        BaseCache<T, Key>& current( void )
+        {
+            QSharedPointer<BaseCache<T, Key>>& cache( _caches[DevicePixelRatio::currentKey()] );
+            if( !cache )
+            {
+                cache.reset( new BaseCache<T, Key>() );
+                cache->setMaxCost( _maxCost );
+                cache->setEnabled( _enabled );
+            }
+
+            return *cache;
+        }
+
+        //* max cost
+        int _maxCost;
+
+        //* enable flag
+        bool _enabled = true;
+
+        //* caches, per device pixel ratio key
+        QHash<int, QSharedPointer<BaseCache<T, Key>>> _caches;
+
     };
 
     /**
@@ -131,6 +301,14 @@ namespace Oxygen
             { f(item.second); }
         }
 
+        //* for_each
+        template<typename F>
+        void for_each(F f) const
+        {
+            for(const auto &item : m_queue)
+            { f(item.second); }
+        }
+
         //* maxCost
         void setMaxCost( size_t max )
         {
@@ -171,10 +349,10 @@ namespace Oxygen
 
         using Value = QSharedPointer<BaseCache<T>>;
 
-        //* return cache matching a given key
+        //* return cache matching a given key and the current device pixel ratio
         Value get( const QColor& color )
         {
-            const quint64 key = ( color.isValid() ? color.rgba():0 );
+            const quint64 key = ( color.isValid() ? color.rgba():0 ) | ( quint64( DevicePixelRatio::currentKey() ) << 32 );
 
             Value retValue = data_.find( key );
             if ( !retValue )
@@ -197,6 +375,14 @@ namespace Oxygen
             data_.for_each( [value] (Value item) { item->setMaxCost( value );} );
         }
 
+        //* number of entries and bytes held, for all colors and device pixel ratios
+        MemoryFootprint::Usage usage( void ) const
+        {
+            MemoryFootprint::Usage out;
+            data_.for_each( [&out] (const Value& item) { out += item->usage();} );
+            return out;
+        }
+
         private:
 
         //* data
@@ -229,6 +415,9 @@ namespace Oxygen
         //* update maximum cache size
         virtual void setMaxCacheSize( int );
 
+        //* add caches memory usage to report
+        virtual void memoryFootprint( MemoryFootprint& ) const;
+
         //*@name window background gradients
         //@{
         /**
@@ -475,8 +664,60 @@ namespace Oxygen
         ColorCache _backgroundColorCache;
         //@}
 
+        //* background gradients. They are smooth, and rendered at a fixed resolution
         PixmapCache _backgroundCache;
-        PixmapCache _dotCache;
+
+        //* dots
+        DevicePixelRatioCache<QPixmap> _dotCache;
+
+        //* rounded mask cache key
+        class MaskKey
+        {
+            public:
+
+            //* constructor
+            explicit MaskKey( const QSize& size, int corners, qreal radius = 0, qreal devicePixelRatio = 0 ):
+                _size( size ),
+                _corners( corners ),
+                _radius( radius ),
+                _devicePixelRatio( devicePixelRatio )
+            {}
+
+            //* equal to operator
+            bool operator == ( const MaskKey& other ) const
+            {
+                return
+                    _size == other._size &&
+                    _corners == other._corners &&
+                    _radius == other._radius &&
+                    _devicePixelRatio == other._devicePixelRatio;
+            }
+
+            //* hash
+            friend uint qHash( const MaskKey& key, uint seed = 0 )
+            {
+                return
+                    qHash( ( quint64( quint32( key._size.width() ) ) << 32 ) | quint32( key._size.height() ), seed ) ^
+                    qHash( key._corners, seed ) ^
+                    qHash( key._radius, seed ) ^
+                    qHash( key._devicePixelRatio, seed );
+            }
+
+            private:
+
+            QSize _size;
+            int _corners;
+            qreal _radius;
+            qreal _devicePixelRatio;
+
+        };
+
+        //*@name rounded mask caches
+        /** regions are stored at origin, and translated to the requested rect on use */
+        //@{
+        mutable BaseCache<QRegion, MaskKey> _roundedRegionCache;
+        mutable BaseCache<QBitmap, MaskKey> _roundedMaskCache;
+        //@}
 
         //* high threshold colors
         using ColorMap = QMap<quint32, bool>;
@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////
+// oxygenmemoryfootprint.cpp
+// memory held by caches, animation data and helper widgets
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygenmemoryfootprint.h"
+
+#include <QTextStream>
+#include <QVariantMap>
+
+namespace Oxygen
+{
+
+    //______________________________________________________________
+    MemoryFootprint::Usage MemoryFootprint::total( const QString& category ) const
+    {
+        Usage out;
+        for( const Entry& entry:_entries )
+        { if( category.isEmpty() || entry._category == category ) out += entry._usage; }
+
+        return out;
+    }
+
+    //______________________________________________________________
+    QVariantList MemoryFootprint::toVariantList( void ) const
+    {
+        QVariantList out;
+        for( const Entry& entry:_entries )
+        {
+            QVariantMap map;
+            map.insert( QStringLiteral( "category" ), entry._category );
+            map.insert( QStringLiteral( "name" ), entry._name );
+            map.insert( QStringLiteral( "count" ), entry._usage._count );
+            map.insert( QStringLiteral( "bytes" ), entry._usage._bytes );
+            out.append( map );
+        }
+
+        return out;
+    }
+
+    //______________________________________________________________
+    void MemoryFootprint::print( QTextStream& out ) const
+    {
+        out << "category\tname\tcount\tbytes\n";
+        for( const Entry& entry:_entries )
+        { out << entry._category << "\t" << entry._name << "\t" << entry._usage._count << "\t" << entry._usage._bytes << "\n"; }
+
+        const Usage sum( total() );
+        out << "total\t\t" << sum._count << "\t" << sum._bytes << "\n";
+    }
+
+    //______________________________________________________________
+    qint64 MemoryFootprint::bytes( const TileSet& tileSet )
+    {
+        qint64 out( 0 );
+        if( !tileSet.isValid() ) return out;
+
+        for( int i = 0; i < 9; ++i )
+        { out += bytes( tileSet.pixmap( i ) ); }
+
+        return out;
+    }
+
+    //______________________________________________________________
+    qint64 MemoryFootprint::bytes( const QIcon& icon )
+    {
+
+        // icons built from pixmaps report one size per stored pixmap
+        qint64 out( 0 );
+        for( const QIcon::Mode mode:{ QIcon::Normal, QIcon::Disabled, QIcon::Active, QIcon::Selected } )
+        {
+            for( const QIcon::State state:{ QIcon::Off, QIcon::On } )
+            {
+                const auto sizes( icon.availableSizes( mode, state ) );
+                for( const QSize& size:sizes )
+                { out += 4*qint64( size.width() )*size.height(); }
+            }
+        }
+
+        return out;
+
+    }
+
+}
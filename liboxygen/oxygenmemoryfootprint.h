@@ -0,0 +1,144 @@
+#ifndef oxygenmemoryfootprint_h
+#define oxygenmemoryfootprint_h
+
+//////////////////////////////////////////////////////////////////////////////
+// oxygenmemoryfootprint.h
+// memory held by caches, animation data and helper widgets
+// -------------------
+//
+// SPDX-FileCopyrightText: 2021 Oxygen Style Authors
+//
+// SPDX-License-Identifier: MIT
+//////////////////////////////////////////////////////////////////////////////
+
+#include "oxygentileset.h"
+#include "oxygen_export.h"
+
+#include <QBitmap>
+#include <QIcon>
+#include <QImage>
+#include <QPixmap>
+#include <QRegion>
+#include <QString>
+#include <QVariantList>
+#include <QVector>
+
+class QTextStream;
+
+namespace Oxygen
+{
+
+    //* memory held by the style, reported per cache or per kind of object
+    /**
+    bytes account for pixel data only. Bookkeeping overhead is ignored,
+    and implicitly shared pixmaps are counted once per holder, so that values are an upper bound
+    */
+    class OXYGEN_EXPORT MemoryFootprint
+    {
+
+        public:
+
+        //* usage of a single cache or kind of object
+        class Usage
+        {
+
+            public:
+
+            //* constructor
+            explicit Usage( int count = 0, qint64 bytes = 0 ):
+                _count( count ),
+                _bytes( bytes )
+            {}
+
+            //* sum
+            Usage& operator += ( const Usage& other )
+            {
+                _count += other._count;
+                _bytes += other._bytes;
+                return *this;
+            }
+
+            //* number of objects
+            int _count;
+
+            //* bytes
+            qint64 _bytes;
+
+        };
+
+        //* report entry
+        class Entry
+        {
+
+            public:
+
+            //* category, for instance helper or animations
+            QString _category;
+
+            //* cache or object name
+            QString _name;
+
+            //* usage
+            Usage _usage;
+
+        };
+
+        using EntryList = QVector<Entry>;
+
+        //* add entry
+        void add( const QString& category, const QString& name, const Usage& usage )
+        { _entries.append( { category, name, usage } ); }
+
+        //* add entry
+        void add( const QString& category, const QString& name, int count, qint64 bytes = 0 )
+        { add( category, name, Usage( count, bytes ) ); }
+
+        //* entries
+        const EntryList& entries( void ) const
+        { return _entries; }
+
+        //* total usage, for all entries or for a given category
+        Usage total( const QString& category = QString() ) const;
+
+        //* entries as a list of maps with category, name, count and bytes keys
+        /** used to pass the report across plugin boundaries, without linking to the style */
+        QVariantList toVariantList( void ) const;
+
+        //* print as a table
+        void print( QTextStream& ) const;
+
+        //*@name bytes held by cached objects
+        //@{
+
+        static qint64 bytes( const QPixmap& pixmap )
+        { return qint64( pixmap.width() )*pixmap.height()*pixmap.depth()/8; }
+
+        static qint64 bytes( const QBitmap& bitmap )
+        { return bytes( static_cast<const QPixmap&>( bitmap ) ); }
+
+        static qint64 bytes( const QImage& image )
+        { return image.sizeInBytes(); }
+
+        static qint64 bytes( const QRegion& region )
+        { return qint64( region.rectCount() )*sizeof( QRect ); }
+
+        static qint64 bytes( const TileSet& );
+
+        static qint64 bytes( const QIcon& );
+
+        //* plain values, such as colors, sizes and rects
+        template<typename T> static qint64 bytes( const T& )
+        { return sizeof( T ); }
+
+        //@}
+
+        private:
+
+        //* entries
+        EntryList _entries;
+
+    };
+
+}
+
+#endif
@@ -209,26 +209,21 @@ namespace Oxygen
         QPainter painter( &shadow );
         painter.setRenderHint( QPainter::Antialiasing );
 
-        QPixmap inactiveShadow( pixmap( key, false ) );
+        // base pixmaps are shared, and faded at draw time
+        const QPixmap inactiveShadow( pixmap( key, false ) );
         if( !inactiveShadow.isNull() )
         {
-            QPainter local( &inactiveShadow );
-            local.setRenderHint( QPainter::Antialiasing );
-            local.setCompositionMode(QPainter::CompositionMode_DestinationIn);
-            local.fillRect( inactiveShadow.rect(), QColor( 0, 0, 0, 255*(1.0-opacity ) ) );
+            painter.setOpacity( 1.0-opacity );
+            painter.drawPixmap( QPointF(0,0), inactiveShadow );
         }
 
-        QPixmap activeShadow( pixmap( key, true ) );
+        const QPixmap activeShadow( pixmap( key, true ) );
         if( !activeShadow.isNull() )
         {
-            QPainter local( &activeShadow );
-            local.setRenderHint( QPainter::Antialiasing );
-            local.setCompositionMode(QPainter::CompositionMode_DestinationIn);
-            local.fillRect( activeShadow.rect(), QColor( 0, 0, 0, 255*( opacity ) ) );
+            painter.setOpacity( opacity );
+            painter.drawPixmap( QPointF(0,0), activeShadow );
         }
 
-        painter.drawPixmap( QPointF(0,0), inactiveShadow );
-        painter.drawPixmap( QPointF(0,0), activeShadow );
         painter.end();
 
         return shadow;
@@ -237,6 +232,24 @@ namespace Oxygen
 
     //_______________________________________________________
     QPixmap ShadowCache::pixmap( const Key& key, bool active ) const
+    {
+
+        // rendering only depends on active state and border
+        const int hash( ( active << 1 ) | ( key.hasBorder || key.isShade ) );
+        if( _enabled )
+        {
+            if( QPixmap* cachedPixmap = _pixmapCache.object( hash ) )
+            { return *cachedPixmap; }
+        }
+
+        const QPixmap shadow( renderPixmap( key, active ) );
+        if( _enabled ) _pixmapCache.insert( hash, new QPixmap( shadow ) );
+        return shadow;
+
+    }
+
+    //_______________________________________________________
+    QPixmap ShadowCache::renderPixmap( const Key& key, bool active ) const
     {
 
         static const qreal fixedSize = 25.5;
@@ -75,6 +75,15 @@ namespace Oxygen
         {
             _shadowCache.clear();
             _animatedShadowCache.clear();
+            _pixmapCache.clear();
+        }
+
+        //* add caches memory usage to report
+        void memoryFootprint( MemoryFootprint& footprint, const QString& category ) const
+        {
+            footprint.add( category, QStringLiteral( "shadow" ), _shadowCache.usage() );
+            footprint.add( category, QStringLiteral( "animatedShadow" ), _animatedShadowCache.usage() );
+            footprint.add( category, QStringLiteral( "shadowPixmap" ), _pixmapCache.usage() );
         }
 
         //* true if shadow is enabled for a given group
@@ -140,9 +149,12 @@ namespace Oxygen
         Helper& helper( void ) const
         { return _helper; }
 
-        //* simple pixmap
+        //* simple pixmap, cached
         QPixmap pixmap( const Key&, bool active ) const;
 
+        //* render simple pixmap
+        QPixmap renderPixmap( const Key&, bool active ) const;
+
         //* draw gradient into rect
         /*! a separate method is used in order to properly account for corners */
         void renderGradient( QPainter&, const QRectF&, const QRadialGradient&, bool hasBorder = true ) const;
@@ -166,8 +178,8 @@ namespace Oxygen
         /*! it is used to set caches max cost, and calculate animation opacity */
         int _maxIndex;
 
-        //* cache
-        using TileSetCache = QCache<int, TileSet>;
+        //* cache. Contents are rendered at the current device pixel ratio, so caches are split per ratio
+        using TileSetCache = DevicePixelRatioCache<TileSet, int>;
 
         //* shadow cache
         TileSetCache _shadowCache;
@@ -175,6 +187,9 @@ namespace Oxygen
         //* animated shadow cache
         TileSetCache _animatedShadowCache;
 
+        //* base active and inactive pixmaps, shared by all animation steps
+        mutable DevicePixelRatioCache<QPixmap, int> _pixmapCache;
+
     };
 
 }